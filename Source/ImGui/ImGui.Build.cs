@@ -23,6 +23,11 @@ public class ImGui : ModuleRules
 		// Enable runtime loader, if you want this module to be automatically loaded in runtime builds (monolithic).
 		bool bEnableRuntimeLoader = true;
 
+		// Enable to build a minimal runtime version of this module: without ImGui demo windows, debug tools and module
+		// debug code, starting only when used for the first time and, in shipping builds, with draw delegates reduced
+		// to inline no-ops.
+		bool bRuntimeLite = false;
+
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
 #if UE_4_24_OR_LATER
@@ -95,8 +100,16 @@ public class ImGui : ModuleRules
 
 #if !UE_4_19_OR_LATER
 		List<string> PrivateDefinitions = Definitions;
+		List<string> PublicDefinitions = Definitions;
 #endif
 
+		// Stage pre-built font atlases, which the font atlas cache loads from the project's content directory.
+		if (Target.ProjectFile != null)
+		{
+			RuntimeDependencies.Add("$(ProjectDir)/Content/ImGui/FontAtlasCache/*.imfontatlas", StagedFileType.UFS);
+		}
+
 		PrivateDefinitions.Add(string.Format("RUNTIME_LOADER_ENABLED={0}", bEnableRuntimeLoader ? 1 : 0));
+		PublicDefinitions.Add(string.Format("IMGUI_RUNTIME_LITE={0}", bRuntimeLite ? 1 : 0));
 	}
 }
@@ -3,12 +3,15 @@
 #include "ImGuiContextManager.h"
 
 #include "ImGuiDelegatesContainer.h"
+#include "ImGuiFontAtlasCache.h"
 #include "ImGuiImplementation.h"
 #include "ImGuiModuleSettings.h"
 #include "ImGuiModule.h"
 #include "Utilities/WorldContext.h"
 #include "Utilities/WorldContextIndex.h"
 
+#include <Algo/Count.h>
+#include <Async/Async.h>
 #include <imgui.h>
 
 
@@ -56,28 +59,95 @@ namespace
 	}
 
 #endif // WITH_EDITOR
+
+	// Build atlas with added fonts. Can be called from worker threads, as long as nothing else accesses the atlas.
+	void BuildFontAtlasData(ImFontAtlas& Atlas, float Scale, bool bUseCache)
+	{
+		// Contexts can be used or released by the game thread while we build, so we shouldn't touch them.
+		ImGuiImplementation::FContextFreeScope ContextFreeScope;
+
+		// Building atlases with large fonts can be expensive, so if possible, we load them from the cache.
+		const uint64 CacheKey = bUseCache ? ImGuiFontAtlasCache::CalculateKey(Atlas, Scale) : 0;
+		const bool bLoadedFromCache = bUseCache && ImGuiFontAtlasCache::Load(CacheKey, Atlas);
+
+		// Only build coverage data. Texture data in the target format are created when the texture is updated.
+		unsigned char* Pixels;
+		int Width, Height;
+		Atlas.GetTexDataAsAlpha8(&Pixels, &Width, &Height);
+
+		if (bUseCache && !bLoadedFromCache)
+		{
+			ImGuiFontAtlasCache::Save(CacheKey, Atlas);
+		}
+	}
+
+	// DPI scales are rounded to quarter steps (typical for display scaling), so contexts with similar scales share
+	// font atlases.
+	FORCEINLINE float GetFontAtlasDPIScale(float Scale)
+	{
+		return FMath::Max(FMath::RoundToFloat(Scale * 4.f) * 0.25f, 0.25f);
+	}
+
+	// Maximum number of font atlases that we try to keep. More atlases are kept, if they are still used by contexts.
+	constexpr int32 MaxFontAtlases = 4;
+
+	// Number of ticks for which unused font atlas is kept, before it can be released.
+	constexpr uint32 FontAtlasReleaseDelay = 3;
+
+#if WITH_EDITOR
+	// Number of contexts created in advance, so starting multi-client PIE sessions doesn't need to initialize them.
+	constexpr int32 ContextPoolSize = 4;
+#endif
 }
 
 FImGuiContextManager::FImGuiContextManager(FImGuiModuleSettings& InSettings)
 	: Settings(InSettings)
 {
 	Settings.OnDPIScaleChangedDelegate.AddRaw(this, &FImGuiContextManager::SetDPIScale);
+	Settings.OnRasterizeGlyphsOnDemandChanged.AddRaw(this, &FImGuiContextManager::SetRasterizeGlyphsOnDemand);
+
+	// Rebuilt atlases can have different font metrics and fonts allocated at addresses of released ones, so cached
+	// text measurements are no longer valid.
+	OnFontAtlasBuilt.AddRaw(this, &FImGuiContextManager::ClearTextCaches);
 
+	GlyphCache.SetEnabled(Settings.RasterizeGlyphsOnDemand());
 	SetDPIScale(Settings.GetDPIScaleInfo());
-	BuildFontAtlas();
+}
+
+void FImGuiContextManager::Initialize()
+{
+	if (!bIsInitialized)
+	{
+		bIsInitialized = true;
 
-	FWorldDelegates::OnWorldTickStart.AddRaw(this, &FImGuiContextManager::OnWorldTickStart);
+		BuildFontAtlas(GetFontAtlasData(DPIScale));
+
+		FWorldDelegates::OnWorldTickStart.AddRaw(this, &FImGuiContextManager::OnWorldTickStart);
 #if ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
-	FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FImGuiContextManager::OnWorldPostActorTick);
+		FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FImGuiContextManager::OnWorldPostActorTick);
 #endif
+	}
 }
 
 FImGuiContextManager::~FImGuiContextManager()
 {
+	// Background build writes to the pending atlas, so we need to wait for it to finish.
+	if (FontAtlasBuildTask.IsValid())
+	{
+		FontAtlasBuildTask.Wait();
+	}
+
+	// Cache files are written by tasks running module code.
+	ImGuiFontAtlasCache::WaitForPendingSaves();
+
 	// Early dealloc of contexts for clean shutdown order
-	Contexts.Reset();
+	ContextSlots.Reset();
+#if WITH_EDITOR
+	ContextPool.Reset();
+#endif
 	
 	Settings.OnDPIScaleChangedDelegate.RemoveAll(this);
+	Settings.OnRasterizeGlyphsOnDemandChanged.RemoveAll(this);
 
 	// Order matters because contexts can be created during World Tick Start events.
 	FWorldDelegates::OnWorldTickStart.RemoveAll(this);
@@ -86,22 +156,53 @@ FImGuiContextManager::~FImGuiContextManager()
 #endif
 }
 
+void FImGuiContextManager::ForEachFontAtlas(TFunctionRef<void(ImFontAtlas&, const FName&)> Function)
+{
+	for (const TUniquePtr<FFontAtlasData>& Data : FontAtlases)
+	{
+		if (Data->FontAtlas.IsBuilt())
+		{
+			Function(Data->FontAtlas, Data->TextureName);
+		}
+	}
+}
+
 void FImGuiContextManager::Tick(float DeltaSeconds)
 {
+	TickCount++;
+
+	// Swap in the font atlas built in the background, before contexts tick and bind to fonts.
+	if (FontAtlasBuildTask.IsValid() && FontAtlasBuildTask.IsReady())
+	{
+		FinishFontAtlasBuild();
+	}
+
+	// Bind contexts to atlases matching their DPI scales.
+	UpdateContextFontAtlases();
+
 	// In editor, worlds can get invalid. We could remove corresponding entries, but that would mean resetting ImGui
 	// context every time when PIE session is restarted. Instead we freeze contexts until their worlds are re-created.
 
-	for (auto& Pair : Contexts)
+	// Contexts can be created by draw events, so we iterate by index and don't keep references to slots across ticks.
+	for (int32 SlotIndex = 0; SlotIndex < ContextSlots.Num(); SlotIndex++)
 	{
-		auto& ContextData = Pair.Value;
-		if (ContextData.CanTick())
+		FContextSlot& Slot = ContextSlots[SlotIndex];
+		if (!Slot.Data.IsSet())
+		{
+			continue;
+		}
+
+		if (Slot.Data->CanTick())
 		{
-			ContextData.ContextProxy->Tick(DeltaSeconds);
+			Slot.Data->ContextProxy->Tick(DeltaSeconds);
 		}
 		else
 		{
 			// Clear to make sure that we don't store objects registered for world that is no longer valid.
-			FImGuiDelegatesContainer::Get().OnWorldDebug(Pair.Key).Clear();
+			if (FImGuiWorldDelegates* Delegates = FImGuiDelegatesContainer::Get().FindWorldDelegates(Slot.ContextIndex))
+			{
+				Delegates->Debug.Clear();
+			}
 		}
 	}
 
@@ -110,7 +211,28 @@ void FImGuiContextManager::Tick(float DeltaSeconds)
 	if (FontResourcesReleaseCountdown > 0 && !--FontResourcesReleaseCountdown)
 	{
 		FontResourcesToRelease.Empty();
+
+		for (const FName& TextureName : FontTexturesToRelease)
+		{
+			OnFontAtlasReleased.Broadcast(TextureName);
+		}
+		FontTexturesToRelease.Empty();
+	}
+
+	// Glyphs requested during text rendering are added in batches. We wait until the old resources are released, so
+	// we don't rebuild more often than once per release cycle.
+	if (GlyphCache.HasPendingGlyphs() && FontResourcesReleaseCountdown == 0 && !IsBuildingFontAtlas())
+	{
+		GlyphCache.CommitPendingGlyphs();
+		RebuildFontAtlas();
 	}
+
+#if WITH_EDITOR
+	FillContextPool();
+#endif
+
+	BeginRequestedFontAtlasBuild();
+	ReleaseUnusedFontAtlases();
 }
 
 #if ENGINE_COMPATIBILITY_LEGACY_WORLD_ACTOR_TICK
@@ -151,11 +273,11 @@ void FImGuiContextManager::OnWorldPostActorTick(UWorld* World, ELevelTick TickTy
 #if WITH_EDITOR
 FImGuiContextManager::FContextData& FImGuiContextManager::GetEditorContextData()
 {
-	FContextData* Data = Contexts.Find(Utilities::EDITOR_CONTEXT_INDEX);
+	FContextData* Data = FindContextData(Utilities::EDITOR_CONTEXT_INDEX);
 
 	if (UNLIKELY(!Data))
 	{
-		Data = &Contexts.Emplace(Utilities::EDITOR_CONTEXT_INDEX, FContextData{ GetEditorContextName(), Utilities::EDITOR_CONTEXT_INDEX, FontAtlas, DPIScale, -1 });
+		Data = &AddContextData(Utilities::EDITOR_CONTEXT_INDEX, FContextData{ GetEditorContextName(), Utilities::EDITOR_CONTEXT_INDEX, GetContextFontAtlasData(Utilities::EDITOR_CONTEXT_INDEX), -1 });
 		OnContextProxyCreated.Broadcast(Utilities::EDITOR_CONTEXT_INDEX, *Data->ContextProxy);
 	}
 
@@ -166,11 +288,11 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetEditorContextData()
 #if !WITH_EDITOR
 FImGuiContextManager::FContextData& FImGuiContextManager::GetStandaloneWorldContextData()
 {
-	FContextData* Data = Contexts.Find(Utilities::STANDALONE_GAME_CONTEXT_INDEX);
+	FContextData* Data = FindContextData(Utilities::STANDALONE_GAME_CONTEXT_INDEX);
 
 	if (UNLIKELY(!Data))
 	{
-		Data = &Contexts.Emplace(Utilities::STANDALONE_GAME_CONTEXT_INDEX, FContextData{ GetWorldContextName(), Utilities::STANDALONE_GAME_CONTEXT_INDEX, FontAtlas, DPIScale });
+		Data = &AddContextData(Utilities::STANDALONE_GAME_CONTEXT_INDEX, FContextData{ GetWorldContextName(), Utilities::STANDALONE_GAME_CONTEXT_INDEX, GetContextFontAtlasData(Utilities::STANDALONE_GAME_CONTEXT_INDEX) });
 		OnContextProxyCreated.Broadcast(Utilities::STANDALONE_GAME_CONTEXT_INDEX, *Data->ContextProxy);
 	}
 
@@ -207,12 +329,23 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetWorldContextData(co
 		Index, *World.GetName(), static_cast<int32>(World.WorldType), static_cast<int32>(World.GetNetMode()));
 #endif
 
-	FContextData* Data = Contexts.Find(Index);
+	FContextData* Data = FindContextData(Index);
 
 #if WITH_EDITOR
 	if (UNLIKELY(!Data))
 	{
-		Data = &Contexts.Emplace(Index, FContextData{ GetWorldContextName(World), Index, FontAtlas, DPIScale, WorldContext->PIEInstance });
+		if (ContextPool.Num() > 0)
+		{
+			// Pooled context only needs to load session data. If it uses a different font atlas than this context should,
+			// it will switch to the right one during the next tick.
+			FPooledContext PooledContext = ContextPool.Pop();
+			PooledContext.ContextProxy->Claim(GetWorldContextName(World), Index);
+			Data = &AddContextData(Index, FContextData{ *PooledContext.FontAtlas, MoveTemp(PooledContext.ContextProxy), WorldContext->PIEInstance });
+		}
+		else
+		{
+			Data = &AddContextData(Index, FContextData{ GetWorldContextName(World), Index, GetContextFontAtlasData(Index), WorldContext->PIEInstance });
+		}
 		OnContextProxyCreated.Broadcast(Index, *Data->ContextProxy);
 	}
 	else
@@ -223,7 +356,7 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetWorldContextData(co
 #else
 	if (UNLIKELY(!Data))
 	{
-		Data = &Contexts.Emplace(Index, FContextData{ GetWorldContextName(World), Index, FontAtlas, DPIScale });
+		Data = &AddContextData(Index, FContextData{ GetWorldContextName(World), Index, GetContextFontAtlasData(Index) });
 		OnContextProxyCreated.Broadcast(Index, *Data->ContextProxy);
 	}
 #endif
@@ -235,76 +368,448 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetWorldContextData(co
 	return *Data;
 }
 
+FImGuiContextManager::FContextData& FImGuiContextManager::AddContextData(int32 ContextIndex, FContextData&& Data)
+{
+	const int32 SlotIndex = Utilities::GetContextSlot(ContextIndex);
+	checkf(SlotIndex >= 0, TEXT("Invalid context index %d."), ContextIndex);
+
+	if (SlotIndex >= ContextSlots.Num())
+	{
+		ContextSlots.SetNum(SlotIndex + 1);
+	}
+
+	FContextSlot& Slot = ContextSlots[SlotIndex];
+	Slot.Data.Emplace(MoveTemp(Data));
+	Slot.ContextIndex = ContextIndex;
+	Slot.Generation++;
+	return Slot.Data.GetValue();
+}
+
+#if WITH_EDITOR
+void FImGuiContextManager::FillContextPool()
+{
+	if (!GIsEditor)
+	{
+		return;
+	}
+
+	// Contexts of PIE instances are kept between sessions, so the pool only needs to cover instances that don't have
+	// their contexts yet. We don't fill it while PIE is running, to not add to the frame time of the session.
+	int32 NumPIEContexts = 0;
+	for (const FContextSlot& Slot : ContextSlots)
+	{
+		if (Slot.Data.IsSet() && Slot.Data->PIEInstance >= 0)
+		{
+			if (Slot.Data->CanTick())
+			{
+				return;
+			}
+			NumPIEContexts++;
+		}
+	}
+
+	// Only one context per tick, to spread the initialization cost.
+	if (ContextPool.Num() + NumPIEContexts < ContextPoolSize)
+	{
+		FFontAtlasData& Data = GetFontAtlasData(DPIScale);
+		if (Data.FontAtlas.IsBuilt())
+		{
+			ContextPool.Add({ &Data, MakeUnique<FImGuiContextProxy>(&Data.FontAtlas, Data.DPIScale) });
+		}
+	}
+}
+#endif // WITH_EDITOR
+
 void FImGuiContextManager::SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo)
 {
-	const float Scale = ScaleInfo.GetImGuiScale();
-	if (DPIScale != Scale)
+	// Contexts switch to font atlas matching the new scale during the next tick. Atlases for recently used scales are
+	// kept, so this only requires a build, if the new scale wasn't used recently.
+	DPIScale = ScaleInfo.GetImGuiScale();
+}
+
+void FImGuiContextManager::SetRasterizeGlyphsOnDemand(bool bRasterizeOnDemand)
+{
+	if (GlyphCache.IsEnabled() != bRasterizeOnDemand)
 	{
-		DPIScale = Scale;
+		GlyphCache.SetEnabled(bRasterizeOnDemand);
 
-		// Only rebuild font atlas if it is already built. Otherwise allow the other logic to pick a moment.
-		if (FontAtlas.IsBuilt())
+		if (FontAtlases.Num() > 0)
 		{
 			RebuildFontAtlas();
 		}
+	}
+}
 
-		
-		for (auto& Pair : Contexts)
+void FImGuiContextManager::SetContextDPIScale(int32 ContextIndex, float Scale)
+{
+	if (Scale > 0.f)
+	{
+		ContextDPIScales.Add(ContextIndex, Scale);
+	}
+	else
+	{
+		ContextDPIScales.Remove(ContextIndex);
+	}
+}
+
+float FImGuiContextManager::GetContextDPIScale(int32 ContextIndex) const
+{
+	const float* Scale = ContextDPIScales.Find(ContextIndex);
+	return Scale ? *Scale : DPIScale;
+}
+
+FImGuiContextManager::FFontAtlasData& FImGuiContextManager::GetFontAtlasData(float Scale)
+{
+	const float AtlasScale = GetFontAtlasDPIScale(Scale);
+
+	for (const TUniquePtr<FFontAtlasData>& Data : FontAtlases)
+	{
+		if (Data->DPIScale == AtlasScale)
+		{
+			return *Data;
+		}
+	}
+
+	// New atlases are built in the background, when no other build is in progress.
+	FFontAtlasData& Data = *FontAtlases.Add_GetRef(MakeUnique<FFontAtlasData>());
+	Data.DPIScale = AtlasScale;
+	Data.TextureName = *FString::Printf(TEXT("ImGuiModule_FontAtlas_%d"), FMath::RoundToInt(AtlasScale * 100.f));
+	Data.LastUsedTick = TickCount;
+	Data.bRebuildRequested = true;
+	return Data;
+}
+
+FImGuiContextManager::FFontAtlasData& FImGuiContextManager::GetContextFontAtlasData(int32 ContextIndex)
+{
+	FFontAtlasData& Data = GetFontAtlasData(GetContextDPIScale(ContextIndex));
+	if (Data.FontAtlas.IsBuilt())
+	{
+		return Data;
+	}
+
+	// Contexts need a built atlas from the start, so until the right one is ready, they use the most recently used one.
+	FFontAtlasData* Fallback = nullptr;
+	for (const TUniquePtr<FFontAtlasData>& Other : FontAtlases)
+	{
+		if (Other->FontAtlas.IsBuilt() && (!Fallback || Other->LastUsedTick > Fallback->LastUsedTick))
 		{
-			if (Pair.Value.ContextProxy)
+			Fallback = Other.Get();
+		}
+	}
+
+	// Contexts requested before initialization wait for the first atlas.
+	if (!Fallback)
+	{
+		BuildFontAtlas(Data);
+		return Data;
+	}
+
+	return *Fallback;
+}
+
+void FImGuiContextManager::UpdateContextFontAtlases()
+{
+	auto UpdateFontAtlas = [this](FFontAtlasData*& ContextFontAtlas, FImGuiContextProxy& ContextProxy, float Scale)
+	{
+		FFontAtlasData& Data = GetFontAtlasData(Scale);
+
+		// Until the atlas for a new scale is built, contexts keep using their current atlas.
+		if (ContextFontAtlas != &Data && Data.FontAtlas.IsBuilt())
+		{
+			ContextFontAtlas = &Data;
+			ContextProxy.SetFontAtlas(&Data.FontAtlas, Data.DPIScale);
+		}
+
+		Data.LastUsedTick = TickCount;
+		ContextFontAtlas->LastUsedTick = TickCount;
+	};
+
+	for (FContextSlot& Slot : ContextSlots)
+	{
+		if (Slot.Data.IsSet())
+		{
+			UpdateFontAtlas(Slot.Data->FontAtlas, *Slot.Data->ContextProxy, GetContextDPIScale(Slot.ContextIndex));
+		}
+	}
+
+#if WITH_EDITOR
+	// Pooled contexts use the default scale and they keep their atlases alive, like contexts frozen between sessions.
+	for (FPooledContext& PooledContext : ContextPool)
+	{
+		UpdateFontAtlas(PooledContext.FontAtlas, *PooledContext.ContextProxy, DPIScale);
+	}
+#endif
+}
+
+void FImGuiContextManager::ClearTextCaches(ImFontAtlas& FontAtlas, const FName& TextureName, const FIntRect& DirtyRegion)
+{
+	for (FContextSlot& Slot : ContextSlots)
+	{
+		if (Slot.Data.IsSet())
+		{
+			Slot.Data->ContextProxy->ClearTextCache();
+		}
+	}
+
+#if WITH_EDITOR
+	for (FPooledContext& PooledContext : ContextPool)
+	{
+		PooledContext.ContextProxy->ClearTextCache();
+	}
+#endif
+}
+
+void FImGuiContextManager::ReleaseUnusedFontAtlases()
+{
+	// Atlases used by contexts are touched every tick, so only atlases that nobody used for a few ticks are released,
+	// starting from the least recently used one. We always keep at least one built atlas for new contexts.
+	while (FontAtlases.Num() > MaxFontAtlases)
+	{
+		const int32 NumBuilt = Algo::CountIf(FontAtlases, [](const TUniquePtr<FFontAtlasData>& Data) { return Data->FontAtlas.IsBuilt(); });
+
+		int32 ReleaseIndex = INDEX_NONE;
+		for (int32 Index = 0; Index < FontAtlases.Num(); Index++)
+		{
+			const FFontAtlasData& Data = *FontAtlases[Index];
+			if (&Data != BuildingFontAtlas && TickCount - Data.LastUsedTick > FontAtlasReleaseDelay
+				&& (!Data.FontAtlas.IsBuilt() || NumBuilt > 1)
+				&& (ReleaseIndex == INDEX_NONE || Data.LastUsedTick < FontAtlases[ReleaseIndex]->LastUsedTick))
 			{
-				Pair.Value.ContextProxy->SetDPIScale(DPIScale);
+				ReleaseIndex = Index;
 			}
 		}
+
+		if (ReleaseIndex == INDEX_NONE)
+		{
+			break;
+		}
+
+		FFontAtlasData& Data = *FontAtlases[ReleaseIndex];
+		if (Data.FontAtlas.IsBuilt())
+		{
+			ReleaseFontAtlasResources(Data.FontAtlas);
+			OnFontAtlasReleased.Broadcast(Data.TextureName);
+		}
+		FontAtlases.RemoveAt(ReleaseIndex);
+	}
+}
+
+void FImGuiContextManager::AddFonts(ImFontAtlas& Atlas, const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs, float Scale)
+{
+	ImFontConfig FontConfig = {};
+	FontConfig.SizePixels = FMath::RoundFromZero(13.f * Scale);
+	Atlas.AddFontDefault(&FontConfig);
+
+	// Bind glyph cache, so it can receive requests for glyphs missing in this atlas.
+	Atlas.UserData = &GlyphCache;
+	GlyphCache.BeginBuild();
+
+	// Build custom fonts
+	for (const TPair<FName, TSharedPtr<ImFontConfig>>& CustomFontPair : CustomFontConfigs)
+	{
+		FName CustomFontName = CustomFontPair.Key;
+		TSharedPtr<ImFontConfig> CustomFontConfig = CustomFontPair.Value;
+
+
+		// Set font name for debugging
+		if (CustomFontConfig.IsValid())
+		{
+			FCStringAnsi::Strncpy(CustomFontConfig->Name, TCHAR_TO_ANSI(*CustomFontName.ToString()), 40);
+			CustomFontConfig->Name[39] = '\0';
+		}
+
+		// Atlas copies the config, so we can narrow glyph ranges in a local copy.
+		ImFontConfig CustomConfig = *CustomFontConfig;
+		GlyphCache.SetupFontConfig(CustomConfig);
+
+		ImFont* font{Atlas.AddFont(&CustomConfig)};
+		font->ContainerAtlas = &Atlas;
+	}
+}
+
+void FImGuiContextManager::BuildFontAtlas(FFontAtlasData& Data, const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs)
+{
+	if (!Data.FontAtlas.IsBuilt())
+	{
+		Data.bRebuildRequested = false;
+		AddFonts(Data.FontAtlas, CustomFontConfigs, Data.DPIScale);
+		BuildFontAtlasData(Data.FontAtlas, Data.DPIScale, Settings.CacheFontAtlas());
+		OnFontAtlasReady(Data, nullptr);
 	}
 }
 
-void FImGuiContextManager::BuildFontAtlas(const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs)
+void FImGuiContextManager::BeginFontAtlasBuild(FFontAtlasData& Data, const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs)
 {
-	if (!FontAtlas.IsBuilt())
+	// Fonts are added on the game thread (atlas copies configs and font data), so the background task doesn't need
+	// to access any shared state.
+	Data.bRebuildRequested = false;
+	Data.PendingFontAtlas = MakeUnique<ImFontAtlas>();
+	AddFonts(*Data.PendingFontAtlas, CustomFontConfigs, Data.DPIScale);
+
+	// Font data that are not owned by the atlas are referenced by configs, so the task holds references to configs
+	// until the build is finished, even if fonts are removed in the meantime.
+	BuildingFontAtlas = &Data;
+	FontAtlasBuildTask = Async(EAsyncExecution::ThreadPool,
+		[Atlas = Data.PendingFontAtlas.Get(), Scale = Data.DPIScale, bUseCache = Settings.CacheFontAtlas(), FontConfigs = CustomFontConfigs]()
+		{
+			BuildFontAtlasData(*Atlas, Scale, bUseCache);
+		});
+}
+
+void FImGuiContextManager::BeginRequestedFontAtlasBuild()
+{
+	if (IsBuildingFontAtlas())
 	{
-		ImFontConfig FontConfig = {};
-		FontConfig.SizePixels = FMath::RoundFromZero(13.f * DPIScale);
-		FontAtlas.AddFontDefault(&FontConfig);
+		return;
+	}
 
-		// Build custom fonts
-		for (const TPair<FName, TSharedPtr<ImFontConfig>>& CustomFontPair : CustomFontConfigs)
+	// Atlases are built one at a time, because builds share glyph ranges prepared by the glyph cache. Most recently
+	// used atlases go first, so contexts waiting for a new scale get it as soon as possible.
+	FFontAtlasData* Requested = nullptr;
+	for (const TUniquePtr<FFontAtlasData>& Data : FontAtlases)
+	{
+		if (Data->bRebuildRequested && (!Requested || Data->LastUsedTick > Requested->LastUsedTick))
 		{
-			FName CustomFontName = CustomFontPair.Key;
-			TSharedPtr<ImFontConfig> CustomFontConfig = CustomFontPair.Value;
+			Requested = Data.Get();
+		}
+	}
 
+	if (Requested)
+	{
+		BeginFontAtlasBuild(*Requested, FImGuiModule::Get().GetProperties().GetCustomFonts());
+	}
+}
+
+void FImGuiContextManager::FinishFontAtlasBuild()
+{
+	FFontAtlasData& Data = *BuildingFontAtlas;
+	BuildingFontAtlas = nullptr;
+	FontAtlasBuildTask.Reset();
+
+	const ImFontAtlas* PreviousFontAtlas = nullptr;
+	if (Data.FontAtlas.IsBuilt())
+	{
+		ReleaseFontAtlasResources(Data.FontAtlas);
+		PreviousFontAtlas = FontResourcesToRelease.Last().Get();
+	}
 
-			// Set font name for debugging
-			if (CustomFontConfig.IsValid())
+	Swap(Data.FontAtlas, *Data.PendingFontAtlas);
+	Data.PendingFontAtlas.Reset();
+
+	// Contexts reference the atlas by its address, so fonts moved from the pending atlas need to point to it.
+	for (ImFont* Font : Data.FontAtlas.Fonts)
+	{
+		Font->ContainerAtlas = &Data.FontAtlas;
+	}
+
+	OnFontAtlasReady(Data, PreviousFontAtlas);
+}
+
+void FImGuiContextManager::OnFontAtlasReady(FFontAtlasData& Data, const ImFontAtlas* PreviousFontAtlas)
+{
+	// When glyphs are only added to the free space of the previous atlas, the texture can be updated in place, because
+	// the previous atlas doesn't reference the updated rows. Otherwise, contexts can still draw with the previous
+	// atlas, so the new one gets a new texture and the previous texture is released with the previous atlas.
+	if (PreviousFontAtlas && !IsFontAtlasLayoutUnchanged(Data.FontAtlas, *PreviousFontAtlas))
+	{
+		FontTexturesToRelease.Add(Data.TextureName);
+		Data.TextureName.SetNumber(Data.TextureName.GetNumber() + 1);
+		PreviousFontAtlas = nullptr;
+	}
+
+	UpdateFontAtlasDirtyRegion(Data, PreviousFontAtlas);
+	OnFontAtlasBuilt.Broadcast(Data.FontAtlas, Data.TextureName, Data.DirtyRegion);
+}
+
+bool FImGuiContextManager::IsFontAtlasLayoutUnchanged(const ImFontAtlas& FontAtlas, const ImFontAtlas& PreviousFontAtlas)
+{
+	if (FontAtlas.TexWidth != PreviousFontAtlas.TexWidth || FontAtlas.TexHeight != PreviousFontAtlas.TexHeight
+		|| FontAtlas.Fonts.Size != PreviousFontAtlas.Fonts.Size || FontAtlas.CustomRects.Size != PreviousFontAtlas.CustomRects.Size)
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < FontAtlas.CustomRects.Size; Index++)
+	{
+		const ImFontAtlasCustomRect& Rect = FontAtlas.CustomRects[Index];
+		const ImFontAtlasCustomRect& PreviousRect = PreviousFontAtlas.CustomRects[Index];
+		if (Rect.X != PreviousRect.X || Rect.Y != PreviousRect.Y)
+		{
+			return false;
+		}
+	}
+
+	// Every glyph of the previous atlas needs to stay at the same place.
+	for (int32 FontIndex = 0; FontIndex < FontAtlas.Fonts.Size; FontIndex++)
+	{
+		ImFont* Font = FontAtlas.Fonts[FontIndex];
+		for (const ImFontGlyph& PreviousGlyph : PreviousFontAtlas.Fonts[FontIndex]->Glyphs)
+		{
+			const ImFontGlyph* Glyph = Font->FindGlyphNoFallback(static_cast<ImWchar>(PreviousGlyph.Codepoint));
+			if (!Glyph || Glyph->U0 != PreviousGlyph.U0 || Glyph->V0 != PreviousGlyph.V0
+				|| Glyph->U1 != PreviousGlyph.U1 || Glyph->V1 != PreviousGlyph.V1)
 			{
-				FCStringAnsi::Strncpy(CustomFontConfig->Name, TCHAR_TO_ANSI(*CustomFontName.ToString()), 40);
-				CustomFontConfig->Name[39] = '\0';
+				return false;
 			}
-			
-			ImFont* font{FontAtlas.AddFont(CustomFontConfig.Get())};
-			font->ContainerAtlas = &FontAtlas;
 		}
+	}
 
-		unsigned char* Pixels;
-		int Width, Height, Bpp;
-		FontAtlas.GetTexDataAsRGBA32(&Pixels, &Width, &Height, &Bpp);
+	return true;
+}
 
-		OnFontAtlasBuilt.Broadcast();
+void FImGuiContextManager::RebuildFontAtlas()
+{
+	// Building large fonts can take a long time, so new atlases are built in the background, while contexts keep
+	// using the current ones. Requests that come in the meantime are merged into a single rebuild of each atlas.
+	for (const TUniquePtr<FFontAtlasData>& Data : FontAtlases)
+	{
+		Data->bRebuildRequested = true;
 	}
+
+	BeginRequestedFontAtlasBuild();
 }
 
-void FImGuiContextManager::RebuildFontAtlas()
+void FImGuiContextManager::ReleaseFontAtlasResources(ImFontAtlas& FontAtlas)
+{
+	// Keep the old resources alive for a few frames to give all contexts a chance to bind to new ones.
+	FontResourcesToRelease.Add(TUniquePtr<ImFontAtlas>(new ImFontAtlas()));
+	Swap(*FontResourcesToRelease.Last(), FontAtlas);
+
+	// Typically, one frame should be enough but since we allow for custom ticking, we need at least to frames to
+	// wait for contexts that already ticked and will not do that before the end of the next tick of this manager.
+	FontResourcesReleaseCountdown = 3;
+}
+
+void FImGuiContextManager::UpdateFontAtlasDirtyRegion(FFontAtlasData& Data, const ImFontAtlas* PreviousFontAtlas)
 {
-	if (FontAtlas.IsBuilt())
+	const ImFontAtlas& FontAtlas = Data.FontAtlas;
+	const int32 Width = FontAtlas.TexWidth;
+	const int32 Height = FontAtlas.TexHeight;
+
+	Data.DirtyRegion = { 0, 0, Width, Height };
+
+	if (PreviousFontAtlas && PreviousFontAtlas->TexPixelsAlpha8 && FontAtlas.TexPixelsAlpha8
+		&& PreviousFontAtlas->TexWidth == Width && PreviousFontAtlas->TexHeight == Height)
 	{
-		// Keep the old resources alive for a few frames to give all contexts a chance to bind to new ones.
-		FontResourcesToRelease.Add(TUniquePtr<ImFontAtlas>(new ImFontAtlas()));
-		Swap(*FontResourcesToRelease.Last(), FontAtlas);
+		// Alpha channel carries all the information, so it is enough to compare alpha data.
+		auto IsRowDirty = [&](int32 Row)
+		{
+			const int32 Offset = Row * Width;
+			return FMemory::Memcmp(FontAtlas.TexPixelsAlpha8 + Offset, PreviousFontAtlas->TexPixelsAlpha8 + Offset, Width) != 0;
+		};
 
-		// Typically, one frame should be enough but since we allow for custom ticking, we need at least to frames to
-		// wait for contexts that already ticked and will not do that before the end of the next tick of this manager.
-		FontResourcesReleaseCountdown = 3;
-	}
+		int32 MinRow = 0;
+		while (MinRow < Height && !IsRowDirty(MinRow))
+		{
+			MinRow++;
+		}
 
-	BuildFontAtlas(FImGuiModule::Get().GetProperties().GetCustomFonts());
+		int32 MaxRow = Height;
+		while (MaxRow > MinRow && !IsRowDirty(MaxRow - 1))
+		{
+			MaxRow--;
+		}
+
+		Data.DirtyRegion = { 0, MinRow, Width, MaxRow };
+	}
 }
@@ -3,8 +3,13 @@
 #pragma once
 
 #include "ImGuiContextProxy.h"
+#include "ImGuiGlyphCache.h"
+#include "Utilities/WorldContextIndex.h"
 #include "VersionCompatibility.h"
 
+#include <Async/Future.h>
+#include <Misc/Optional.h>
+
 
 class FImGuiModuleSettings;
 struct FImGuiDPIScaleInfo;
@@ -12,11 +17,29 @@ struct FImGuiDPIScaleInfo;
 // TODO: It might be useful to broadcast FContextProxyCreatedDelegate to users, to support similar cases to our ImGui
 // demo, but we would need to remove from that interface internal classes.
 
+// Handle to a context proxy, which resolves with a single array access. It becomes invalid, if the context is removed,
+// even if a new context is later created with the same index.
+struct FImGuiContextProxyHandle
+{
+	int32 Slot = INDEX_NONE;
+	uint32 Generation = 0;
+};
+
 // Delegate called when new context proxy is created.
 // @param ContextIndex - Index for that world
 // @param ContextProxy - Created context proxy
 DECLARE_MULTICAST_DELEGATE_TwoParams(FContextProxyCreatedDelegate, int32, FImGuiContextProxy&);
 
+// Delegate called after font atlas is built.
+// @param FontAtlas - Built font atlas
+// @param TextureName - Name of the texture that should be used for that font atlas
+// @param DirtyRegion - Region of the atlas texture that changed since the previous build
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FFontAtlasBuiltDelegate, ImFontAtlas&, const FName&, const FIntRect&);
+
+// Delegate called when font atlas is released.
+// @param TextureName - Name of the texture used for that font atlas
+DECLARE_MULTICAST_DELEGATE_OneParam(FFontAtlasReleasedDelegate, const FName&);
+
 // Manages ImGui context proxies.
 class FImGuiContextManager
 {
@@ -32,8 +55,16 @@ public:
 
 	~FImGuiContextManager();
 
-	ImFontAtlas& GetFontAtlas() { return FontAtlas; }
-	const ImFontAtlas& GetFontAtlas() const { return FontAtlas; }
+	// Build the initial font atlas and start creating contexts for ticking worlds. Before that, contexts are only
+	// created on request and the font atlas is built together with the first one.
+	void Initialize();
+
+	// Whether the initial font atlas was built and world delegates are registered.
+	bool IsInitialized() const { return bIsInitialized; }
+
+	// Call a function for every built font atlas. Contexts with different DPI scales use different font atlases.
+	// @param Function - Function called with the font atlas and the name of its texture
+	void ForEachFontAtlas(TFunctionRef<void(ImFontAtlas&, const FName&)> Function);
 
 #if WITH_EDITOR
 	// Get or create editor ImGui context proxy.
@@ -54,35 +85,108 @@ public:
 	// Get context proxy by index, or null if context with that index doesn't exist.
 	FORCEINLINE FImGuiContextProxy* GetContextProxy(int32 ContextIndex)
 	{
-		FContextData* Data = Contexts.Find(ContextIndex);
+		FContextData* Data = FindContextData(ContextIndex);
 		return Data ? Data->ContextProxy.Get() : nullptr;
 	}
 
+	// Get handle to context proxy by index. If context with that index doesn't exist, handle will not resolve.
+	FImGuiContextProxyHandle GetContextProxyHandle(int32 ContextIndex) const
+	{
+		const int32 Slot = Utilities::GetContextSlot(ContextIndex);
+		return (ContextSlots.IsValidIndex(Slot) && ContextSlots[Slot].Data.IsSet())
+			? FImGuiContextProxyHandle{ Slot, ContextSlots[Slot].Generation } : FImGuiContextProxyHandle{};
+	}
+
+	// Get context proxy from handle, or null if handle doesn't point to an existing context.
+	FORCEINLINE FImGuiContextProxy* GetContextProxy(const FImGuiContextProxyHandle& Handle)
+	{
+		if (ContextSlots.IsValidIndex(Handle.Slot))
+		{
+			FContextSlot& Slot = ContextSlots[Handle.Slot];
+			if (Slot.Generation == Handle.Generation && Slot.Data.IsSet())
+			{
+				return Slot.Data->ContextProxy.Get();
+			}
+		}
+		return nullptr;
+	}
+
 	// Delegate called when a new context proxy is created.
 	FContextProxyCreatedDelegate OnContextProxyCreated;
 
-	// Delegate called after font atlas is built.
-	FSimpleMulticastDelegate OnFontAtlasBuilt;
+	// Delegate called after font atlas is built. After rebuilds that don't change the atlas size, dirty region is limited
+	// to rows that differ from the previous atlas, otherwise it covers the whole texture.
+	FFontAtlasBuiltDelegate OnFontAtlasBuilt;
+
+	// Delegate called when font atlas that is no longer used is released.
+	FFontAtlasReleasedDelegate OnFontAtlasReleased;
+
+	// Whether font atlas is being rebuilt in the background. Until it is finished, contexts use the previous atlas.
+	bool IsBuildingFontAtlas() const { return FontAtlasBuildTask.IsValid(); }
 
 	void Tick(float DeltaSeconds);
 
 	void RebuildFontAtlas();
 
+	// Set the DPI scale for a context, overriding the scale from the module settings. Fonts are kept for a few recently
+	// used scales, so switching between them doesn't require rebuilding font atlas.
+	// @param ContextIndex - Index of the context
+	// @param Scale - The DPI scale or non-positive value to use the scale from the module settings
+	void SetContextDPIScale(int32 ContextIndex, float Scale);
+
 private:
 
+	// Font atlas for a DPI scale bucket. It is allocated at a stable address, so contexts can reference it.
+	struct FFontAtlasData
+	{
+		ImFontAtlas FontAtlas;
+		TUniquePtr<ImFontAtlas> PendingFontAtlas;
+		FName TextureName;
+		FIntRect DirtyRegion;
+		float DPIScale = 1.f;
+		uint32 LastUsedTick = 0;
+		bool bRebuildRequested = false;
+	};
+
 	struct FContextData
 	{
-		FContextData(const FString& ContextName, int32 ContextIndex, ImFontAtlas& FontAtlas, float DPIScale, int32 InPIEInstance = -1)
+		FContextData(const FString& ContextName, int32 ContextIndex, FFontAtlasData& InFontAtlas, int32 InPIEInstance = -1)
 			: PIEInstance(InPIEInstance)
-			, ContextProxy(new FImGuiContextProxy(ContextName, ContextIndex, &FontAtlas, DPIScale))
+			, FontAtlas(&InFontAtlas)
+			, ContextProxy(new FImGuiContextProxy(ContextName, ContextIndex, &InFontAtlas.FontAtlas, InFontAtlas.DPIScale))
+		{
+		}
+
+		FContextData(FFontAtlasData& InFontAtlas, TUniquePtr<FImGuiContextProxy>&& InContextProxy, int32 InPIEInstance)
+			: PIEInstance(InPIEInstance)
+			, FontAtlas(&InFontAtlas)
+			, ContextProxy(MoveTemp(InContextProxy))
 		{
 		}
 
 		FORCEINLINE bool CanTick() const { return PIEInstance < 0 || GEngine->GetWorldContextFromPIEInstance(PIEInstance); }
 
 		int32 PIEInstance = -1;
+		FFontAtlasData* FontAtlas = nullptr;
+		TUniquePtr<FImGuiContextProxy> ContextProxy;
+	};
+
+	// Slot for a context with a given index. Generation is incremented every time a context is added to the slot.
+	struct FContextSlot
+	{
+		TOptional<FContextData> Data;
+		int32 ContextIndex = Utilities::INVALID_CONTEXT_INDEX;
+		uint32 Generation = 0;
+	};
+
+#if WITH_EDITOR
+	// Context created in advance, which is not yet bound to any world.
+	struct FPooledContext
+	{
+		FFontAtlasData* FontAtlas = nullptr;
 		TUniquePtr<FImGuiContextProxy> ContextProxy;
 	};
+#endif
 
 #if ENGINE_COMPATIBILITY_LEGACY_WORLD_ACTOR_TICK
 	void OnWorldTickStart(ELevelTick TickType, float DeltaSeconds);
@@ -103,16 +207,68 @@ private:
 
 	FContextData& GetWorldContextData(const UWorld& World, int32* OutContextIndex = nullptr);
 
+	FORCEINLINE FContextData* FindContextData(int32 ContextIndex)
+	{
+		const int32 Slot = Utilities::GetContextSlot(ContextIndex);
+		return (ContextSlots.IsValidIndex(Slot) && ContextSlots[Slot].Data.IsSet()) ? &ContextSlots[Slot].Data.GetValue() : nullptr;
+	}
+
+	FContextData& AddContextData(int32 ContextIndex, FContextData&& Data);
+
+#if WITH_EDITOR
+	void FillContextPool();
+#endif
+
 	void SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo);
-	void BuildFontAtlas(const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs = {});
+	void SetRasterizeGlyphsOnDemand(bool bRasterizeOnDemand);
+
+	float GetContextDPIScale(int32 ContextIndex) const;
+	FFontAtlasData& GetFontAtlasData(float Scale);
+	FFontAtlasData& GetContextFontAtlasData(int32 ContextIndex);
+	void UpdateContextFontAtlases();
+	void ClearTextCaches(ImFontAtlas& FontAtlas, const FName& TextureName, const FIntRect& DirtyRegion);
+	void ReleaseUnusedFontAtlases();
+
+	void BuildFontAtlas(FFontAtlasData& Data, const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs = {});
+	void BeginFontAtlasBuild(FFontAtlasData& Data, const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs);
+	void BeginRequestedFontAtlasBuild();
+	void FinishFontAtlasBuild();
+	void AddFonts(ImFontAtlas& Atlas, const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs, float Scale);
+	void OnFontAtlasReady(FFontAtlasData& Data, const ImFontAtlas* PreviousFontAtlas);
+	void UpdateFontAtlasDirtyRegion(FFontAtlasData& Data, const ImFontAtlas* PreviousFontAtlas);
+	static bool IsFontAtlasLayoutUnchanged(const ImFontAtlas& FontAtlas, const ImFontAtlas& PreviousFontAtlas);
+	void ReleaseFontAtlasResources(ImFontAtlas& FontAtlas);
+
+	// Contexts indexed by context slots (see Utilities::GetContextSlot), so they can be found and iterated without
+	// hashing.
+	TArray<FContextSlot> ContextSlots;
+
+#if WITH_EDITOR
+	// Contexts created in advance for PIE instances.
+	TArray<FPooledContext> ContextPool;
+#endif
 
-	TMap<int32, FContextData> Contexts;
+	// DPI scales set for individual contexts.
+	TMap<int32, float> ContextDPIScales;
 
-	ImFontAtlas FontAtlas;
+	// Font atlases for recently used DPI scales.
+	TArray<TUniquePtr<FFontAtlasData>> FontAtlases;
 	TArray<TUniquePtr<ImFontAtlas>> FontResourcesToRelease;
 
+	// Textures of re-packed atlases, released together with the atlases that use them.
+	TArray<FName> FontTexturesToRelease;
+
+	// Font atlas built in the background and the task building it.
+	FFontAtlasData* BuildingFontAtlas = nullptr;
+	TFuture<void> FontAtlasBuildTask;
+
+	FImGuiGlyphCache GlyphCache;
+
 	FImGuiModuleSettings& Settings;
 
 	float DPIScale = -1.f;
 	int32 FontResourcesReleaseCountdown = 0;
+	uint32 TickCount = 0;
+
+	bool bIsInitialized = false;
 };
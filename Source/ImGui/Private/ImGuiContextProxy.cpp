@@ -2,8 +2,11 @@
 
 #include "ImGuiContextProxy.h"
 
+#include "ImGuiDebugDrawQueue.h"
+#include "ImGuiDeferredQueue.h"
 #include "ImGuiDelegatesContainer.h"
 #include "ImGuiImplementation.h"
+#include "ImGuiInputRecording.h"
 #include "ImGuiInteroperability.h"
 #include "Utilities/Arrays.h"
 #include "VersionCompatibility.h"
@@ -71,12 +74,40 @@ namespace
 		ImGuiContext* OldContext = nullptr;
 		bool bRestore = true;
 	};
+
+	// Restores navigation flags of the input state (and ImGui IO config flags set by them) when leaving a scope.
+	struct FGuardNavigationFlags
+	{
+		FGuardNavigationFlags(FImGuiInputState& InInputState)
+			: InputState(InInputState)
+			, bKeyboardNavigation(InInputState.IsKeyboardNavigationEnabled())
+			, bGamepadNavigation(InInputState.IsGamepadNavigationEnabled())
+			, bHasGamepad(InInputState.HasGamepad())
+		{
+		}
+
+		~FGuardNavigationFlags()
+		{
+			InputState.SetKeyboardNavigationEnabled(bKeyboardNavigation);
+			InputState.SetGamepadNavigationEnabled(bGamepadNavigation);
+			InputState.SetGamepad(bHasGamepad);
+		}
+
+		FGuardNavigationFlags(const FGuardNavigationFlags&) = delete;
+		FGuardNavigationFlags& operator=(const FGuardNavigationFlags&) = delete;
+
+	private:
+
+		FImGuiInputState& InputState;
+		bool bKeyboardNavigation;
+		bool bGamepadNavigation;
+		bool bHasGamepad;
+	};
 }
 
 FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextIndex, ImFontAtlas* InFontAtlas, float InDPIScale)
 	: Name(InName)
 	, ContextIndex(InContextIndex)
-	, IniFilename(GetIniFile(InName))
 {
 	// Create context.
 	Context = ImGui::CreateContext(InFontAtlas);
@@ -84,11 +115,32 @@ FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextInd
 	// Set this context in ImGui for initialization (any allocations will be tracked in this context).
 	SetAsCurrent();
 
-	// Start initialization.
+	// Session data are persisted by the proxy rather than by ImGui, so they are not written on the game thread.
+	ImGui::GetIO().IniFilename = nullptr;
+	IniFile.SetFilename(GetIniFile(InName));
+	IniFile.Load();
+
+	Initialize(InDPIScale);
+}
+
+FImGuiContextProxy::FImGuiContextProxy(ImFontAtlas* InFontAtlas, float InDPIScale)
+{
+	// Create context without session data storage. Pooled contexts are created outside of world ticks, so we restore
+	// the current context afterwards.
+	FGuardCurrentContext GuardContext;
+	Context = ImGui::CreateContext(InFontAtlas);
+	SetAsCurrent();
+	ImGui::GetIO().IniFilename = nullptr;
+
+	Initialize(InDPIScale);
+}
+
+void FImGuiContextProxy::Initialize(float InDPIScale)
+{
 	ImGuiIO& IO = ImGui::GetIO();
 
-	// Set session data storage.
-	IO.IniFilename = StringCast<ANSICHAR>(*IniFilename).Get();
+	// Text measurements are cached per context (see IMGUI_TEXT_CACHE hooks).
+	ImGuiTextCache::SetContextCache(Context, &TextCache);
 
 	// Start with the default canvas size.
 	ResetDisplaySize();
@@ -97,9 +149,6 @@ FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextInd
 	// Set the initial DPI scale.
 	SetDPIScale(InDPIScale);
 
-	// Initialize key mapping, so context can correctly interpret input state.
-	ImGuiInterops::SetUnrealKeyMap();
-
 	// Begin frame to complete context initialization (this is to avoid problems with other systems calling to ImGui
 	// during startup).
 	BeginFrame();
@@ -117,10 +166,28 @@ FImGuiContextProxy::~FImGuiContextProxy()
 		EndFrame();	
 		
 		// Save context data and destroy.
+		IniFile.Save();
+		IniFile.Flush();
+		ImGuiTextCache::SetContextCache(Context, nullptr);
 		ImGui::DestroyContext(Context);
 	}
 }
 
+void FImGuiContextProxy::Claim(const FString& InName, int32 InContextIndex)
+{
+	Name = InName;
+	ContextIndex = InContextIndex;
+	WorldDelegates = nullptr;
+
+	FGuardCurrentContext GuardContext;
+	SetAsCurrent();
+
+	// First frame of a pooled context started without session data and nothing has been drawn since, so we can load
+	// them now and windows created from this point will be restored from them.
+	IniFile.SetFilename(GetIniFile(InName));
+	IniFile.Load();
+}
+
 void FImGuiContextProxy::ResetDisplaySize()
 {
 	DisplaySize = { DEFAULT_CANVAS_WIDTH, DEFAULT_CANVAS_HEIGHT };
@@ -141,6 +208,28 @@ void FImGuiContextProxy::SetDPIScale(float Scale)
 	}
 }
 
+void FImGuiContextProxy::SetFontAtlas(ImFontAtlas* FontAtlas, float Scale)
+{
+	PendingFontAtlas = FontAtlas;
+	PendingFontAtlasDPIScale = Scale;
+}
+
+void FImGuiContextProxy::ApplyPendingFontAtlas()
+{
+	if (PendingFontAtlas)
+	{
+		ImGuiIO& IO = ImGui::GetIO();
+
+		// Atlases for different scales have the same fonts in the same order, so we can map the default font by index.
+		const int32 DefaultFontIndex = (IO.FontDefault && IO.Fonts) ? IO.Fonts->Fonts.index_from_ptr(IO.Fonts->Fonts.find(IO.FontDefault)) : INDEX_NONE;
+		IO.Fonts = PendingFontAtlas;
+		IO.FontDefault = (DefaultFontIndex >= 0 && DefaultFontIndex < IO.Fonts->Fonts.Size) ? IO.Fonts->Fonts[DefaultFontIndex] : nullptr;
+
+		SetDPIScale(PendingFontAtlasDPIScale);
+		PendingFontAtlas = nullptr;
+	}
+}
+
 void FImGuiContextProxy::DrawEarlyDebug()
 {
 	if (bIsFrameStarted && !bIsDrawEarlyDebugCalled)
@@ -166,8 +255,12 @@ void FImGuiContextProxy::DrawDebug()
 
 		SetAsCurrent();
 
-		// Delegates called in order specified in FImGuiDelegates.
+		// Delegates called in order specified in FImGuiDelegates, with deferred commands replayed before multi-context
+		// delegates, so those can still draw footers.
 		BroadcastWorldDebug();
+#if IMGUI_WITH_DELEGATES
+		FImGuiDeferredQueue::Get().Replay(ContextIndex);
+#endif
 		BroadcastMultiContextDebug();
 	}
 }
@@ -204,6 +297,64 @@ void FImGuiContextProxy::Tick(float DeltaSeconds)
 	}
 }
 
+void FImGuiContextProxy::SetInputRecording(FImGuiInputRecording* Recording)
+{
+	InputRecording = Recording;
+	InputState.SetRecordedEvents(Recording ? &Recording->GetRecordedEvents() : nullptr);
+}
+
+TArray<double> FImGuiContextProxy::ReplayInput(const FImGuiInputRecording& Recording, float FixedDeltaTime)
+{
+	TArray<double> FrameTimes;
+	FrameTimes.Reserve(Recording.GetFrames().Num());
+
+	FGuardCurrentContext GuardContext;
+	SetAsCurrent();
+
+	// Don't record replayed input.
+	FImGuiInputRecording* LiveInputRecording = InputRecording;
+	SetInputRecording(nullptr);
+
+	// Finish the current frame and drop live input, so replay doesn't depend on what happened before it.
+	if (bIsFrameStarted)
+	{
+		DrawDebug();
+		EndFrame();
+	}
+	InputState.ClearEvents();
+
+	{
+		// Recorded navigation flags are only used during replay.
+		FGuardNavigationFlags NavigationFlagsGuard(InputState);
+
+		for (const FImGuiInputRecordingFrame& Frame : Recording.GetFrames())
+		{
+			const double StartTime = FPlatformTime::Seconds();
+
+			InputState.SetKeyboardNavigationEnabled(Frame.NavigationFlags & FImGuiInputRecordingFrame::NavigationFlag_Keyboard);
+			InputState.SetGamepadNavigationEnabled(Frame.NavigationFlags & FImGuiInputRecordingFrame::NavigationFlag_Gamepad);
+			InputState.SetGamepad(Frame.NavigationFlags & FImGuiInputRecordingFrame::NavigationFlag_HasGamepad);
+
+			// Recorded events were already merged and ordered by the journal, so we pass them directly to ImGui IO.
+			InputState.SetCurrentFrameIO(&ImGui::GetIO());
+			InputState.ApplyEvents(Frame.Events);
+
+			BeginFrame(FixedDeltaTime > 0.f ? FixedDeltaTime : Frame.DeltaTime);
+			DrawDebug();
+			EndFrame();
+
+			FrameTimes.Add(FPlatformTime::Seconds() - StartTime);
+		}
+	}
+
+	SetInputRecording(LiveInputRecording);
+
+	// Set the context back to a state in which it allows to draw controls.
+	BeginFrame();
+
+	return FrameTimes;
+}
+
 void FImGuiContextProxy::BeginFrame(float DeltaTime)
 {
 	if (!bIsFrameStarted)
@@ -212,14 +363,29 @@ void FImGuiContextProxy::BeginFrame(float DeltaTime)
 		IO.DeltaTime = DeltaTime;
 
 		InputState.SetCurrentFrameIO(&IO);
-		InputState.ClearUpdateState();
 
+		InputState.FlushEvents();
 
+		if (InputRecording)
+		{
+			InputRecording->AddFrame(GFrameNumber, DeltaTime, InputState);
+		}
+		InputState.ClearUpdateState();
+
+		ApplyPendingFontAtlas();
+		TextCache.Tick();
 
 		IO.DisplaySize = ImVec2(DisplaySize.X, DisplaySize.Y);
 		
 		ImGui::NewFrame();
 
+		// ImGui only lets us know when settings should be saved, since we don't give it the ini file.
+		if (IO.WantSaveIniSettings)
+		{
+			IniFile.Save();
+			IO.WantSaveIniSettings = false;
+		}
+
 		bIsFrameStarted = true;
 		bIsDrawEarlyDebugCalled = false;
 		bIsDrawDebugCalled = false;
@@ -230,6 +396,11 @@ void FImGuiContextProxy::EndFrame()
 {
 	if (bIsFrameStarted)
 	{
+#if IMGUI_WITH_DELEGATES
+		// Debug primitives are drawn last, on top of all windows.
+		FImGuiDebugDrawQueue::Get().Draw(ContextIndex);
+#endif
+
 		// Prepare draw data (after this call we cannot draw to this context until we start a new frame).
 		ImGui::Render();
 
@@ -259,14 +430,25 @@ void FImGuiContextProxy::UpdateDrawData(ImDrawData* DrawData)
 	}
 }
 
+FImGuiWorldDelegates* FImGuiContextProxy::GetWorldDelegates()
+{
+	// Until something is registered for this context, there are no delegates to cache, but looking for them doesn't
+	// create any.
+	if (!WorldDelegates && ContextIndex != Utilities::INVALID_CONTEXT_INDEX)
+	{
+		WorldDelegates = FImGuiDelegatesContainer::Get().FindWorldDelegates(ContextIndex);
+	}
+
+	return WorldDelegates;
+}
+
 void FImGuiContextProxy::BroadcastWorldEarlyDebug()
 {
-	if (ContextIndex != Utilities::INVALID_CONTEXT_INDEX)
+	if (FImGuiWorldDelegates* Delegates = GetWorldDelegates())
 	{
-		FSimpleMulticastDelegate& WorldEarlyDebugEvent = FImGuiDelegatesContainer::Get().OnWorldEarlyDebug(ContextIndex);
-		if (WorldEarlyDebugEvent.IsBound())
+		if (Delegates->EarlyDebug.IsBound())
 		{
-			WorldEarlyDebugEvent.Broadcast();
+			Delegates->EarlyDebug.Broadcast();
 		}
 	}
 }
@@ -287,12 +469,11 @@ void FImGuiContextProxy::BroadcastWorldDebug()
 		DrawEvent.Broadcast();
 	}
 
-	if (ContextIndex != Utilities::INVALID_CONTEXT_INDEX)
+	if (FImGuiWorldDelegates* Delegates = GetWorldDelegates())
 	{
-		FSimpleMulticastDelegate& WorldDebugEvent = FImGuiDelegatesContainer::Get().OnWorldDebug(ContextIndex);
-		if (WorldDebugEvent.IsBound())
+		if (Delegates->Debug.IsBound())
 		{
-			WorldDebugEvent.Broadcast();
+			Delegates->Debug.Broadcast();
 		}
 	}
 }
@@ -3,13 +3,19 @@
 #pragma once
 
 #include "ImGuiDrawData.h"
+#include "ImGuiIniFile.h"
 #include "ImGuiInputState.h"
+#include "ImGuiTextCache.h"
 #include "Utilities/WorldContextIndex.h"
 
 #include <GenericPlatform/ICursor.h>
 
 #include <imgui.h>
 
+
+class FImGuiInputRecording;
+struct FImGuiWorldDelegates;
+
 // Represents a single ImGui context. All the context updates should be done through this proxy. During update it
 // broadcasts draw events to allow listeners draw their controls. After update it stores draw data.
 class FImGuiContextProxy
@@ -17,6 +23,11 @@ class FImGuiContextProxy
 public:
 
 	FImGuiContextProxy(const FString& Name, int32 InContextIndex, ImFontAtlas* InFontAtlas, float InDPIScale);
+
+	// Create a context that is not yet bound to any world. It completes initialization, but doesn't load session data
+	// until it is claimed, so it can be created in advance and claimed later without any startup cost.
+	FImGuiContextProxy(ImFontAtlas* InFontAtlas, float InDPIScale);
+
 	~FImGuiContextProxy();
 
 	FImGuiContextProxy(const FImGuiContextProxy&) = delete;
@@ -28,6 +39,11 @@ public:
 	// Get the name of this context.
 	const FString& GetName() const { return Name; }
 
+	// Bind a context created in advance to a world and load its session data.
+	// @param InName - Name of the context, which also identifies its session data
+	// @param InContextIndex - Index of the context
+	void Claim(const FString& InName, int32 InContextIndex);
+
 	// Get draw data from the last frame.
 	const TArray<FImGuiDrawList>& GetDrawData() const { return DrawLists; }
 
@@ -35,6 +51,16 @@ public:
 	FImGuiInputState& GetInputState() { return InputState; }
 	const FImGuiInputState& GetInputState() const { return InputState; }
 
+	// Set the recording that should receive input passed to this context, or null to stop recording.
+	void SetInputRecording(FImGuiInputRecording* Recording);
+
+	// Replay recorded input. Recorded frames are run immediately one after another, with draw events but without
+	// waiting for engine frames. Input received in the meantime is discarded.
+	// @param Recording - Recorded input
+	// @param FixedDeltaTime - Delta time of replayed frames or non-positive value to use recorded delta times
+	// @returns Time in seconds it took to run each replayed frame
+	TArray<double> ReplayInput(const FImGuiInputRecording& Recording, float FixedDeltaTime);
+
 	// Is this context the current ImGui context.
 	bool IsCurrentContext() const { return ImGui::GetCurrentContext() == Context; }
 
@@ -56,6 +82,15 @@ public:
 	// Set the DPI scale for this context.
 	void SetDPIScale(float Scale);
 
+	// Set the font atlas for this context, together with the DPI scale for which it was built. Change is applied at
+	// the beginning of the next frame, so fonts don't change in the middle of a frame.
+	// @param FontAtlas - The font atlas that should be used by this context
+	// @param Scale - The DPI scale for which the font atlas was built
+	void SetFontAtlas(ImFontAtlas* FontAtlas, float Scale);
+
+	// Clear cached text measurements. Needs to be called when font metrics change.
+	void ClearTextCache() { TextCache.Clear(); }
+
 	// Whether this context has an active item (read once per frame during context update).
 	bool HasActiveItem() const { return bHasActiveItem; }
 
@@ -80,11 +115,16 @@ public:
 
 private:
 
+	void Initialize(float InDPIScale);
+
 	void BeginFrame(float DeltaTime = 1.f / 60.f);
+	void ApplyPendingFontAtlas();
 	void EndFrame();
 
 	void UpdateDrawData(ImDrawData* DrawData);
 
+	FImGuiWorldDelegates* GetWorldDelegates();
+
 	void BroadcastWorldEarlyDebug();
 	void BroadcastMultiContextEarlyDebug();
 
@@ -96,6 +136,9 @@ private:
 	FVector2D DisplaySize = FVector2D::ZeroVector;
 	float DPIScale = 1.f;
 
+	ImFontAtlas* PendingFontAtlas = nullptr;
+	float PendingFontAtlasDPIScale = 1.f;
+
 	EMouseCursor::Type MouseCursor = EMouseCursor::None;
 	bool bHasActiveItem = false;
 	bool bWantsMouseCapture = false;
@@ -105,6 +148,7 @@ private:
 	bool bIsDrawDebugCalled = false;
 
 	FImGuiInputState InputState;
+	FImGuiInputRecording* InputRecording = nullptr;
 
 	TArray<FImGuiDrawList> DrawLists;
 
@@ -115,5 +159,10 @@ private:
 
 	FSimpleMulticastDelegate DrawEvent;
 
-	FString IniFilename;
+	// Delegates registered for this context, cached once they are created.
+	FImGuiWorldDelegates* WorldDelegates = nullptr;
+
+	FImGuiIniFile IniFile;
+
+	FImGuiTextCache TextCache;
 };
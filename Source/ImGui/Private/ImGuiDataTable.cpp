@@ -0,0 +1,405 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiDataTable.h"
+
+#include <Algo/Sort.h>
+#include <Async/Async.h>
+#include <Async/ParallelFor.h>
+
+
+namespace
+{
+	// Rows are filtered in blocks and sorted in chunks, which are then merged. Work is split across worker threads and
+	// cancellation is checked between blocks and chunks.
+	constexpr int32 FilterBlockSize = 4096;
+	constexpr int32 SortChunkSize = 16384;
+
+	// Maximum number of columns in ImGui tables (IMGUI_TABLE_MAX_COLUMNS).
+	constexpr int32 MaxColumns = 512;
+}
+
+//----------------------------------------------------------------------------------------------------
+// FImGuiTableFilter
+//----------------------------------------------------------------------------------------------------
+
+FImGuiTableFilter::FImGuiTableFilter(const char* Text)
+{
+	const char* Begin = Text;
+	while (*Begin)
+	{
+		const char* End = Begin;
+		while (*End && *End != ',')
+		{
+			End++;
+		}
+
+		const char* TermBegin = Begin;
+		const char* TermEnd = End;
+		while (TermBegin < TermEnd && *TermBegin == ' ')
+		{
+			TermBegin++;
+		}
+		while (TermEnd > TermBegin && TermEnd[-1] == ' ')
+		{
+			TermEnd--;
+		}
+
+		const bool bExcluded = TermBegin < TermEnd && *TermBegin == '-';
+		if (bExcluded)
+		{
+			TermBegin++;
+		}
+
+		if (TermBegin < TermEnd)
+		{
+			TArray<ANSICHAR>& Term = (bExcluded ? ExcludedTerms : IncludedTerms).AddDefaulted_GetRef();
+			Term.Append(TermBegin, static_cast<int32>(TermEnd - TermBegin));
+			Term.Add('\0');
+		}
+
+		Begin = *End ? End + 1 : End;
+	}
+}
+
+bool FImGuiTableFilter::PassFilter(const ANSICHAR* Text) const
+{
+	for (const TArray<ANSICHAR>& Term : ExcludedTerms)
+	{
+		if (FCStringAnsi::Stristr(Text, Term.GetData()))
+		{
+			return false;
+		}
+	}
+
+	if (IncludedTerms.Num() == 0)
+	{
+		return true;
+	}
+
+	for (const TArray<ANSICHAR>& Term : IncludedTerms)
+	{
+		if (FCStringAnsi::Stristr(Text, Term.GetData()))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// IImGuiTableDataSource
+//----------------------------------------------------------------------------------------------------
+
+int32 IImGuiTableDataSource::CompareRows(int32 RowA, int32 RowB, int32 Column) const
+{
+	TAnsiStringBuilder<128> TextA;
+	TAnsiStringBuilder<128> TextB;
+	FormatCell(RowA, Column, TextA);
+	FormatCell(RowB, Column, TextB);
+	return FCStringAnsi::Stricmp(*TextA, *TextB);
+}
+
+bool IImGuiTableDataSource::PassFilter(int32 Row, const FImGuiTableFilter& Filter) const
+{
+	TAnsiStringBuilder<256> Text;
+	const int32 NumColumns = GetNumColumns();
+	for (int32 Column = 0; Column < NumColumns; Column++)
+	{
+		if (Column > 0)
+		{
+			Text << '\t';
+		}
+		FormatCell(Row, Column, Text);
+	}
+	return Filter.PassFilter(*Text);
+}
+
+void IImGuiTableDataSource::DrawCell(int32 Row, int32 Column) const
+{
+	TAnsiStringBuilder<128> Text;
+	FormatCell(Row, Column, Text);
+	ImGui::TextUnformatted(Text.GetData(), Text.GetData() + Text.Len());
+}
+
+//----------------------------------------------------------------------------------------------------
+// FImGuiDataTable
+//----------------------------------------------------------------------------------------------------
+
+FImGuiDataTable::FImGuiDataTable(const char* InId, ImGuiTableFlags InFlags)
+	: Flags(InFlags)
+{
+	Id.Append(InId, FCStringAnsi::Strlen(InId) + 1);
+}
+
+FImGuiDataTable::~FImGuiDataTable()
+{
+	// Tasks hold their own references to sources, so they don't need to finish before the table is destroyed.
+	CancelUpdate();
+}
+
+void FImGuiDataTable::SetDataSource(const TSharedPtr<IImGuiTableDataSource, ESPMode::ThreadSafe>& InDataSource)
+{
+	DataSource = InDataSource;
+	if (!ShownSource)
+	{
+		ShownSource = DataSource;
+		ShownRows.Reset();
+		bShowAllRows = true;
+	}
+
+	StartUpdate();
+}
+
+void FImGuiDataTable::Refresh()
+{
+	StartUpdate();
+}
+
+void FImGuiDataTable::StartUpdate()
+{
+	CancelUpdate();
+
+	if (!DataSource)
+	{
+		ShownSource.Reset();
+		ShownRows.Reset();
+		bShowAllRows = true;
+		return;
+	}
+
+	// Rows in their original order don't need any work.
+	if (SortColumns.Num() == 0 && !FilterText[0])
+	{
+		ShownSource = DataSource;
+		ShownRows.Reset();
+		bShowAllRows = true;
+		return;
+	}
+
+	TArray<ANSICHAR> TaskFilterText;
+	TaskFilterText.Append(FilterText, FCStringAnsi::Strlen(FilterText) + 1);
+
+	TaskCancelled = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+	Task = Async(EAsyncExecution::ThreadPool,
+		[Source = DataSource, TaskSortColumns = SortColumns, TaskFilterText = MoveTemp(TaskFilterText), bCancelled = TaskCancelled]()
+		{
+			return SortAndFilter(*Source, TaskSortColumns, TaskFilterText.GetData(), *bCancelled);
+		});
+}
+
+void FImGuiDataTable::CancelUpdate()
+{
+	if (TaskCancelled)
+	{
+		TaskCancelled->store(true, std::memory_order_relaxed);
+		TaskCancelled.Reset();
+	}
+
+	Task.Reset();
+}
+
+void FImGuiDataTable::FinishUpdate()
+{
+	if (Task.IsValid() && Task.IsReady())
+	{
+		ShownSource = DataSource;
+		ShownRows = Task.Consume();
+		bShowAllRows = false;
+
+		Task.Reset();
+		TaskCancelled.Reset();
+	}
+}
+
+void FImGuiDataTable::Draw(const ImVec2& Size)
+{
+	FinishUpdate();
+
+	if (!ShownSource)
+	{
+		return;
+	}
+
+	const IImGuiTableDataSource& Source = *ShownSource;
+	const int32 NumRows = Source.GetNumRows();
+	const int32 NumShownRows = bShowAllRows ? NumRows : ShownRows.Num();
+	const int32 NumColumns = FMath::Min(Source.GetNumColumns(), MaxColumns);
+	if (NumColumns <= 0)
+	{
+		return;
+	}
+
+	// Updates change shown rows, so they are started after drawing.
+	bool bUpdate = false;
+
+	ImGui::PushID(Id.GetData());
+
+	ImGui::AlignTextToFramePadding();
+	ImGui::Text("%d of %d rows%s", NumShownRows, NumRows, IsUpdating() ? " (updating...)" : "");
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(-FLT_MIN);
+	if (ImGui::InputTextWithHint("##Filter", "Filter (inc,-exc)", FilterText, sizeof(FilterText)))
+	{
+		bUpdate = true;
+	}
+
+	if (ImGui::BeginTable(Id.GetData(), NumColumns, Flags, Size))
+	{
+		ImGui::TableSetupScrollFreeze(0, 1);
+		for (int32 Column = 0; Column < NumColumns; Column++)
+		{
+			ImGui::TableSetupColumn(Source.GetColumnName(Column), Source.GetColumnFlags(Column));
+		}
+		ImGui::TableHeadersRow();
+
+		if (ImGuiTableSortSpecs* SortSpecs = ImGui::TableGetSortSpecs())
+		{
+			if (SortSpecs->SpecsDirty)
+			{
+				SortColumns.Reset();
+				for (int32 Index = 0; Index < SortSpecs->SpecsCount; Index++)
+				{
+					const ImGuiTableColumnSortSpecs& Spec = SortSpecs->Specs[Index];
+					SortColumns.Add({ Spec.ColumnIndex, Spec.SortDirection == ImGuiSortDirection_Descending });
+				}
+				SortSpecs->SpecsDirty = false;
+
+				bUpdate = true;
+			}
+		}
+
+		ImGuiListClipper Clipper;
+		Clipper.Begin(NumShownRows);
+		while (Clipper.Step())
+		{
+			for (int32 Index = Clipper.DisplayStart; Index < Clipper.DisplayEnd; Index++)
+			{
+				const int32 Row = bShowAllRows ? Index : ShownRows[Index];
+
+				ImGui::TableNextRow();
+				ImGui::PushID(Row);
+				for (int32 Column = 0; Column < NumColumns; Column++)
+				{
+					// Hidden columns are not drawn.
+					if (ImGui::TableSetColumnIndex(Column))
+					{
+						Source.DrawCell(Row, Column);
+					}
+				}
+				ImGui::PopID();
+			}
+		}
+
+		ImGui::EndTable();
+	}
+
+	ImGui::PopID();
+
+	if (bUpdate)
+	{
+		StartUpdate();
+	}
+}
+
+TArray<int32> FImGuiDataTable::SortAndFilter(const IImGuiTableDataSource& Source, const TArray<FSortColumn>& SortColumns,
+	const char* FilterText, const std::atomic<bool>& bCancelled)
+{
+	const auto IsCancelled = [&bCancelled]() { return bCancelled.load(std::memory_order_relaxed); };
+
+	const int32 NumRows = Source.GetNumRows();
+	TArray<int32> Rows;
+
+	const FImGuiTableFilter Filter(FilterText);
+	if (Filter.IsActive())
+	{
+		TArray<bool> Passed;
+		Passed.SetNumZeroed(NumRows);
+
+		ParallelFor(FMath::DivideAndRoundUp(NumRows, FilterBlockSize), [&](int32 Block)
+		{
+			if (!IsCancelled())
+			{
+				const int32 End = FMath::Min((Block + 1) * FilterBlockSize, NumRows);
+				for (int32 Row = Block * FilterBlockSize; Row < End; Row++)
+				{
+					Passed[Row] = Source.PassFilter(Row, Filter);
+				}
+			}
+		});
+
+		for (int32 Row = 0; Row < NumRows; Row++)
+		{
+			if (Passed[Row])
+			{
+				Rows.Add(Row);
+			}
+		}
+	}
+	else
+	{
+		Rows.SetNumUninitialized(NumRows);
+		for (int32 Row = 0; Row < NumRows; Row++)
+		{
+			Rows[Row] = Row;
+		}
+	}
+
+	const int32 NumSortedRows = Rows.Num();
+	if (SortColumns.Num() == 0 || NumSortedRows < 2 || IsCancelled())
+	{
+		return Rows;
+	}
+
+	// Rows that compare equal keep their original order, so results don't change between sorts.
+	const auto Less = [&Source, &SortColumns](int32 RowA, int32 RowB)
+	{
+		for (const FSortColumn& SortColumn : SortColumns)
+		{
+			const int32 Result = Source.CompareRows(RowA, RowB, SortColumn.Column);
+			if (Result != 0)
+			{
+				return SortColumn.bDescending ? Result > 0 : Result < 0;
+			}
+		}
+		return RowA < RowB;
+	};
+
+	ParallelFor(FMath::DivideAndRoundUp(NumSortedRows, SortChunkSize), [&](int32 Chunk)
+	{
+		if (!IsCancelled())
+		{
+			const int32 Begin = Chunk * SortChunkSize;
+			Algo::Sort(TArrayView<int32>(Rows.GetData() + Begin, FMath::Min(SortChunkSize, NumSortedRows - Begin)), Less);
+		}
+	});
+
+	// Merge sorted ranges of doubling width, until they cover all rows.
+	TArray<int32> MergedRows;
+	MergedRows.SetNumUninitialized(NumSortedRows);
+	for (int32 Width = SortChunkSize; Width < NumSortedRows && !IsCancelled(); Width *= 2)
+	{
+		ParallelFor(FMath::DivideAndRoundUp(NumSortedRows, 2 * Width), [&](int32 Merge)
+		{
+			if (IsCancelled())
+			{
+				return;
+			}
+
+			const int32 Begin = Merge * 2 * Width;
+			const int32 Middle = FMath::Min(Begin + Width, NumSortedRows);
+			const int32 End = FMath::Min(Begin + 2 * Width, NumSortedRows);
+
+			int32 Left = Begin;
+			int32 Right = Middle;
+			for (int32 Out = Begin; Out < End; Out++)
+			{
+				MergedRows[Out] = (Right >= End || (Left < Middle && !Less(Rows[Right], Rows[Left]))) ? Rows[Left++] : Rows[Right++];
+			}
+		});
+
+		Swap(Rows, MergedRows);
+	}
+
+	return Rows;
+}
@@ -0,0 +1,400 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiDebugDrawQueue.h"
+
+#include "ImGuiInteroperability.h"
+#include "Utilities/WorldContextIndex.h"
+
+#include <Engine/Engine.h>
+#include <Engine/GameViewportClient.h>
+#include <Engine/LocalPlayer.h>
+#include <HAL/PlatformTime.h>
+#include <SceneView.h>
+
+
+#if IMGUI_WITH_DELEGATES
+
+namespace
+{
+	// Primitives closer to the view origin (or behind it) are not drawn and segments are clipped at this distance.
+	constexpr double MinClipW = 0.1;
+
+	// Number of segments used to draw circles in world space.
+	constexpr int32 CircleSegments = 32;
+
+	FImGuiDebugPrimitive MakePrimitive(EImGuiDebugPrimitive Type, const UWorld* World, const FColor& Color, float Thickness,
+		float Lifetime)
+	{
+		FImGuiDebugPrimitive Primitive;
+		Primitive.Type = Type;
+		Primitive.ContextIndex = World ? Utilities::GetWorldContextIndex(*World) : FImGuiDebugDrawQueue::MultiContextIndex;
+		Primitive.Color = Color;
+		Primitive.Thickness = Thickness;
+		Primitive.ExpireTime = Lifetime;
+		Primitive.Text[0] = '\0';
+		return Primitive;
+	}
+
+	// Copy text converted to UTF-8, truncated at a character boundary if it doesn't fit.
+	void SetText(FImGuiDebugPrimitive& Primitive, const FString& Text)
+	{
+		const FTCHARToUTF8 Converter(*Text, Text.Len());
+
+		int32 Length = FMath::Min(Converter.Length(), FImGuiDebugPrimitive::MaxTextLength - 1);
+		if (Length < Converter.Length())
+		{
+			while (Length > 0 && (static_cast<uint8>(Converter.Get()[Length]) & 0xC0) == 0x80)
+			{
+				Length--;
+			}
+		}
+
+		FMemory::Memcpy(Primitive.Text, Converter.Get(), Length);
+		Primitive.Text[Length] = '\0';
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// FImGuiDebugDrawQueue
+//----------------------------------------------------------------------------------------------------
+
+FImGuiDebugDrawQueue& FImGuiDebugDrawQueue::Get()
+{
+	static FImGuiDebugDrawQueue Instance;
+	return Instance;
+}
+
+void FImGuiDebugDrawQueue::Add(const FImGuiDebugPrimitive& Primitive)
+{
+	if (Primitive.ContextIndex == Utilities::INVALID_CONTEXT_INDEX)
+	{
+		return;
+	}
+
+	FImGuiDebugDrawThreadQueue& Queue = ThreadQueues.GetThreadInstance();
+
+	const uint32 WritePosition = Queue.WritePosition.load(std::memory_order_relaxed);
+	if (WritePosition - Queue.ReadPosition.load(std::memory_order_acquire) >= FImGuiDebugDrawThreadQueue::Capacity)
+	{
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	Queue.Primitives[WritePosition & (FImGuiDebugDrawThreadQueue::Capacity - 1)] = Primitive;
+	Queue.WritePosition.store(WritePosition + 1, std::memory_order_release);
+
+	ThreadQueues.RequestActivation(TEXT("debug primitive added"));
+}
+
+void FImGuiDebugDrawQueue::Collect(float SlateScale)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	// Primitives without lifetime were drawn in the last frame, so they expire together with the ones that outlived it.
+	Primitives.RemoveAll([Now](const FImGuiDebugPrimitive& Primitive) { return Primitive.ExpireTime <= Now; });
+
+	ThreadQueues.ForEach([this, Now](FImGuiDebugDrawThreadQueue& Queue)
+	{
+		const uint32 ReadPosition = Queue.ReadPosition.load(std::memory_order_relaxed);
+		const uint32 WritePosition = Queue.WritePosition.load(std::memory_order_acquire);
+
+		for (uint32 Position = ReadPosition; Position != WritePosition; Position++)
+		{
+			if (Primitives.Num() < MaxPrimitives)
+			{
+				FImGuiDebugPrimitive& Primitive = Primitives.Add_GetRef(
+					Queue.Primitives[Position & (FImGuiDebugDrawThreadQueue::Capacity - 1)]);
+				Primitive.ExpireTime = Now + FMath::Max(Primitive.ExpireTime, 0.0);
+			}
+			else
+			{
+				NumDropped.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		Queue.ReadPosition.store(WritePosition, std::memory_order_release);
+	});
+
+	UpdateViews(SlateScale);
+}
+
+void FImGuiDebugDrawQueue::UpdateViews(float SlateScale)
+{
+	Views.Reset();
+
+	if (!GEngine || Primitives.Num() == 0)
+	{
+		return;
+	}
+
+	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+	{
+		UWorld* World = WorldContext.World();
+		ULocalPlayer* LocalPlayer = World ? GEngine->GetFirstGamePlayer(World) : nullptr;
+		if (!LocalPlayer || !LocalPlayer->ViewportClient || !LocalPlayer->ViewportClient->Viewport)
+		{
+			continue;
+		}
+
+		FSceneViewProjectionData ProjectionData;
+		if (LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+		{
+			FView& View = Views.Add(Utilities::GetWorldContextIndex(WorldContext));
+			View.ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+			View.ViewRect = ProjectionData.GetConstrainedViewRect();
+			View.SlateScale = FMath::Max(SlateScale, 0.01f);
+		}
+	}
+}
+
+void FImGuiDebugDrawQueue::Draw(int32 ContextIndex) const
+{
+	if (Primitives.Num() == 0)
+	{
+		return;
+	}
+
+	ImDrawList& DrawList = *ImGui::GetForegroundDrawList();
+	const FView* View = Views.Find(ContextIndex);
+
+	for (const FImGuiDebugPrimitive& Primitive : Primitives)
+	{
+		if (Primitive.ContextIndex == ContextIndex || Primitive.ContextIndex == MultiContextIndex)
+		{
+			DrawPrimitive(DrawList, Primitive, View);
+		}
+	}
+}
+
+void FImGuiDebugDrawQueue::DrawPrimitive(ImDrawList& DrawList, const FImGuiDebugPrimitive& Primitive, const FView* View)
+{
+	using namespace ImGuiInterops;
+
+	const ImU32 Color = PackImU32Color(Primitive.Color);
+
+	switch (Primitive.Type)
+	{
+	case EImGuiDebugPrimitive::ScreenLine:
+		DrawList.AddLine(ToImVec2(FVector2D(Primitive.A)), ToImVec2(FVector2D(Primitive.B)), Color, Primitive.Thickness);
+		break;
+
+	case EImGuiDebugPrimitive::ScreenRect:
+		DrawList.AddRect(ToImVec2(FVector2D(Primitive.A)), ToImVec2(FVector2D(Primitive.B)), Color, 0.f, 0, Primitive.Thickness);
+		break;
+
+	case EImGuiDebugPrimitive::ScreenCircle:
+		DrawList.AddCircle(ToImVec2(FVector2D(Primitive.A)), Primitive.Radius, Color, 0, Primitive.Thickness);
+		break;
+
+	case EImGuiDebugPrimitive::ScreenText:
+		DrawList.AddText(ToImVec2(FVector2D(Primitive.A)), Color, Primitive.Text);
+		break;
+
+	case EImGuiDebugPrimitive::Line:
+	{
+		ImVec2 Start, End;
+		if (View && View->ProjectSegment(Primitive.A, Primitive.B, Start, End))
+		{
+			DrawList.AddLine(Start, End, Color, Primitive.Thickness);
+		}
+		break;
+	}
+
+	case EImGuiDebugPrimitive::Box:
+	{
+		if (!View)
+		{
+			break;
+		}
+
+		// Corners indexed by bits of extent signs (X, Y, Z) and edges connecting corners that differ by one bit.
+		FVector Corners[8];
+		const FQuat Rotation(Primitive.Rotation);
+		for (int32 Index = 0; Index < 8; Index++)
+		{
+			const FVector Signs((Index & 1) ? 1. : -1., (Index & 2) ? 1. : -1., (Index & 4) ? 1. : -1.);
+			Corners[Index] = Primitive.A + Rotation.RotateVector(Primitive.B * Signs);
+		}
+
+		for (int32 Index = 0; Index < 8; Index++)
+		{
+			for (int32 Bit = 1; Bit < 8; Bit <<= 1)
+			{
+				ImVec2 Start, End;
+				if (!(Index & Bit) && View->ProjectSegment(Corners[Index], Corners[Index | Bit], Start, End))
+				{
+					DrawList.AddLine(Start, End, Color, Primitive.Thickness);
+				}
+			}
+		}
+		break;
+	}
+
+	case EImGuiDebugPrimitive::Circle:
+	{
+		if (!View)
+		{
+			break;
+		}
+
+		FVector AxisX, AxisY;
+		Primitive.B.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector).FindBestAxisVectors(AxisX, AxisY);
+
+		FVector Previous = Primitive.A + AxisX * Primitive.Radius;
+		for (int32 Segment = 1; Segment <= CircleSegments; Segment++)
+		{
+			double Sin, Cos;
+			FMath::SinCos(&Sin, &Cos, UE_DOUBLE_TWO_PI * Segment / CircleSegments);
+			const FVector Current = Primitive.A + (AxisX * Cos + AxisY * Sin) * Primitive.Radius;
+
+			ImVec2 Start, End;
+			if (View->ProjectSegment(Previous, Current, Start, End))
+			{
+				DrawList.AddLine(Start, End, Color, Primitive.Thickness);
+			}
+
+			Previous = Current;
+		}
+		break;
+	}
+
+	case EImGuiDebugPrimitive::Text:
+	{
+		ImVec2 Position;
+		if (View && View->ProjectPoint(Primitive.A, Position))
+		{
+			DrawList.AddText(Position, Color, Primitive.Text);
+		}
+		break;
+	}
+	}
+}
+
+bool FImGuiDebugDrawQueue::FView::ProjectPoint(const FVector& Point, ImVec2& OutPoint) const
+{
+	const FVector4 ClipPosition = ViewProjectionMatrix.TransformFVector4(FVector4(Point, 1.));
+	if (ClipPosition.W < MinClipW)
+	{
+		return false;
+	}
+
+	OutPoint = ToImGui(ClipPosition);
+	return true;
+}
+
+bool FImGuiDebugDrawQueue::FView::ProjectSegment(const FVector& Start, const FVector& End, ImVec2& OutStart, ImVec2& OutEnd) const
+{
+	FVector4 ClipStart = ViewProjectionMatrix.TransformFVector4(FVector4(Start, 1.));
+	FVector4 ClipEnd = ViewProjectionMatrix.TransformFVector4(FVector4(End, 1.));
+
+	if (ClipStart.W < MinClipW && ClipEnd.W < MinClipW)
+	{
+		return false;
+	}
+
+	// Clip segments crossing the near plane, so they are still drawn in front of the view.
+	if (ClipStart.W < MinClipW)
+	{
+		ClipStart = ClipStart + (ClipEnd - ClipStart) * ((MinClipW - ClipStart.W) / (ClipEnd.W - ClipStart.W));
+	}
+	else if (ClipEnd.W < MinClipW)
+	{
+		ClipEnd = ClipEnd + (ClipStart - ClipEnd) * ((MinClipW - ClipEnd.W) / (ClipStart.W - ClipEnd.W));
+	}
+
+	OutStart = ToImGui(ClipStart);
+	OutEnd = ToImGui(ClipEnd);
+	return true;
+}
+
+ImVec2 FImGuiDebugDrawQueue::FView::ToImGui(const FVector4& ClipPosition) const
+{
+	const double X = ViewRect.Min.X + (0.5 + 0.5 * ClipPosition.X / ClipPosition.W) * ViewRect.Width();
+	const double Y = ViewRect.Min.Y + (0.5 - 0.5 * ClipPosition.Y / ClipPosition.W) * ViewRect.Height();
+	return ImVec2{ static_cast<float>(X / SlateScale), static_cast<float>(Y / SlateScale) };
+}
+
+//----------------------------------------------------------------------------------------------------
+// FImGuiDebugDraw
+//----------------------------------------------------------------------------------------------------
+
+void FImGuiDebugDraw::ScreenLine(const UWorld* World, const FVector2D& Start, const FVector2D& End, const FColor& Color,
+	float Thickness, float Lifetime)
+{
+	FImGuiDebugPrimitive Primitive = MakePrimitive(EImGuiDebugPrimitive::ScreenLine, World, Color, Thickness, Lifetime);
+	Primitive.A = FVector(Start, 0.);
+	Primitive.B = FVector(End, 0.);
+	FImGuiDebugDrawQueue::Get().Add(Primitive);
+}
+
+void FImGuiDebugDraw::ScreenRect(const UWorld* World, const FVector2D& Min, const FVector2D& Max, const FColor& Color,
+	float Thickness, float Lifetime)
+{
+	FImGuiDebugPrimitive Primitive = MakePrimitive(EImGuiDebugPrimitive::ScreenRect, World, Color, Thickness, Lifetime);
+	Primitive.A = FVector(Min, 0.);
+	Primitive.B = FVector(Max, 0.);
+	FImGuiDebugDrawQueue::Get().Add(Primitive);
+}
+
+void FImGuiDebugDraw::ScreenCircle(const UWorld* World, const FVector2D& Center, float Radius, const FColor& Color,
+	float Thickness, float Lifetime)
+{
+	FImGuiDebugPrimitive Primitive = MakePrimitive(EImGuiDebugPrimitive::ScreenCircle, World, Color, Thickness, Lifetime);
+	Primitive.A = FVector(Center, 0.);
+	Primitive.Radius = Radius;
+	FImGuiDebugDrawQueue::Get().Add(Primitive);
+}
+
+void FImGuiDebugDraw::ScreenText(const UWorld* World, const FVector2D& Position, const FString& Label, const FColor& Color,
+	float Lifetime)
+{
+	FImGuiDebugPrimitive Primitive = MakePrimitive(EImGuiDebugPrimitive::ScreenText, World, Color, 1.f, Lifetime);
+	Primitive.A = FVector(Position, 0.);
+	SetText(Primitive, Label);
+	FImGuiDebugDrawQueue::Get().Add(Primitive);
+}
+
+void FImGuiDebugDraw::Line(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color,
+	float Thickness, float Lifetime)
+{
+	FImGuiDebugPrimitive Primitive = MakePrimitive(EImGuiDebugPrimitive::Line, World, Color, Thickness, Lifetime);
+	Primitive.A = Start;
+	Primitive.B = End;
+	FImGuiDebugDrawQueue::Get().Add(Primitive);
+}
+
+void FImGuiDebugDraw::Box(const UWorld* World, const FVector& Center, const FVector& Extent, const FColor& Color,
+	const FQuat& Rotation, float Thickness, float Lifetime)
+{
+	FImGuiDebugPrimitive Primitive = MakePrimitive(EImGuiDebugPrimitive::Box, World, Color, Thickness, Lifetime);
+	Primitive.A = Center;
+	Primitive.B = Extent;
+	Primitive.Rotation = FQuat4f(Rotation);
+	FImGuiDebugDrawQueue::Get().Add(Primitive);
+}
+
+void FImGuiDebugDraw::Circle(const UWorld* World, const FVector& Center, float Radius, const FColor& Color,
+	const FVector& Normal, float Thickness, float Lifetime)
+{
+	FImGuiDebugPrimitive Primitive = MakePrimitive(EImGuiDebugPrimitive::Circle, World, Color, Thickness, Lifetime);
+	Primitive.A = Center;
+	Primitive.B = Normal;
+	Primitive.Radius = Radius;
+	FImGuiDebugDrawQueue::Get().Add(Primitive);
+}
+
+void FImGuiDebugDraw::Text(const UWorld* World, const FVector& Location, const FString& Label, const FColor& Color,
+	float Lifetime)
+{
+	FImGuiDebugPrimitive Primitive = MakePrimitive(EImGuiDebugPrimitive::Text, World, Color, 1.f, Lifetime);
+	Primitive.A = Location;
+	SetText(Primitive, Label);
+	FImGuiDebugDrawQueue::Get().Add(Primitive);
+}
+
+uint64 FImGuiDebugDraw::GetNumDroppedPrimitives()
+{
+	return FImGuiDebugDrawQueue::Get().GetNumDropped();
+}
+
+#endif // IMGUI_WITH_DELEGATES
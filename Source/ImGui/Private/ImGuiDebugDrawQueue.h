@@ -0,0 +1,136 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiDebugDraw.h"
+#include "ImGuiThreadLocalRegistry.h"
+
+#include <Containers/Array.h>
+#include <Containers/Map.h>
+#include <Math/NumericLimits.h>
+#include <Templates/UniquePtr.h>
+
+#include <imgui.h>
+
+#include <atomic>
+
+
+enum class EImGuiDebugPrimitive : uint8
+{
+	ScreenLine,
+	ScreenRect,
+	ScreenCircle,
+	ScreenText,
+	Line,
+	Box,
+	Circle,
+	Text,
+};
+
+// Single debug primitive. Primitives have a fixed size, so they can be passed through ring buffers without allocations.
+struct FImGuiDebugPrimitive
+{
+	static constexpr int32 MaxTextLength = 64;
+
+	// Points of lines and rectangles, centers of boxes and circles and positions of text labels.
+	FVector A;
+
+	// End points of lines, max corners of rectangles, extents of boxes and normals of circles.
+	FVector B;
+
+	// Rotation of boxes.
+	FQuat4f Rotation;
+
+	// Time after which primitive is removed. Until primitive is collected, it holds its lifetime.
+	double ExpireTime = 0.0;
+
+	int32 ContextIndex = 0;
+	float Radius = 0.f;
+	float Thickness = 1.f;
+	FColor Color;
+	EImGuiDebugPrimitive Type = EImGuiDebugPrimitive::ScreenLine;
+
+	// Null-terminated UTF-8 text of labels.
+	ANSICHAR Text[MaxTextLength];
+};
+
+// Primitives added by one thread, passed to the game thread through a single-producer single-consumer ring buffer.
+struct FImGuiDebugDrawThreadQueue
+{
+	// Number of primitives that can wait in the queue (power of two).
+	static constexpr uint32 Capacity = 2048;
+
+	FImGuiDebugDrawThreadQueue()
+		: Primitives(MakeUnique<FImGuiDebugPrimitive[]>(Capacity))
+	{
+	}
+
+	TUniquePtr<FImGuiDebugPrimitive[]> Primitives;
+
+	// Position written by the owning thread.
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> WritePosition{ 0 };
+
+	// Position written by the game thread.
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> ReadPosition{ 0 };
+};
+
+// Queue of debug primitives added by FImGuiDebugDraw on any thread and drawn in contexts on the game thread.
+class FImGuiDebugDrawQueue
+{
+public:
+
+	// Context index of primitives drawn in every context.
+	static constexpr int32 MultiContextIndex = TNumericLimits<int32>::Max();
+
+	// Maximum number of primitives that can be drawn at once.
+	static constexpr int32 MaxPrimitives = 65536;
+
+	// Get the queue instance.
+	static FImGuiDebugDrawQueue& Get();
+
+	// Add a primitive to the queue of the calling thread or drop it, if that queue is full.
+	void Add(const FImGuiDebugPrimitive& Primitive);
+
+	// Get the number of dropped primitives.
+	uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+	// Remove expired primitives, take primitives added since the last call and update views used to project primitives
+	// in world space. Should be called once per frame on the game thread.
+	// @param SlateScale - Scale of ImGui widgets in Slate, used to convert viewport positions to ImGui positions
+	void Collect(float SlateScale);
+
+	// Draw primitives for a context to its foreground draw list. Should be called on the game thread, before the end of
+	// the context's frame.
+	void Draw(int32 ContextIndex) const;
+
+private:
+
+	// Projection from world space to ImGui display coordinates of a context.
+	struct FView
+	{
+		FMatrix ViewProjectionMatrix;
+		FIntRect ViewRect;
+		float SlateScale = 1.f;
+
+		bool ProjectSegment(const FVector& Start, const FVector& End, ImVec2& OutStart, ImVec2& OutEnd) const;
+		bool ProjectPoint(const FVector& Point, ImVec2& OutPoint) const;
+		ImVec2 ToImGui(const FVector4& ClipPosition) const;
+	};
+
+	FImGuiDebugDrawQueue() = default;
+
+	void UpdateViews(float SlateScale);
+
+	static void DrawPrimitive(ImDrawList& DrawList, const FImGuiDebugPrimitive& Primitive, const FView* View);
+
+	// Queues of all threads.
+	TImGuiThreadLocalRegistry<FImGuiDebugDrawThreadQueue> ThreadQueues;
+
+	std::atomic<uint64> NumDropped{ 0 };
+
+	// Primitives to draw, in order in which they were collected.
+	TArray<FImGuiDebugPrimitive> Primitives;
+
+	// Views of contexts with local players.
+	TMap<int32, FView> Views;
+};
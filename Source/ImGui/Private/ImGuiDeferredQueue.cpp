@@ -0,0 +1,557 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiDeferredQueue.h"
+
+#include "Utilities/WorldContextIndex.h"
+
+#include <imgui.h>
+
+#include <cstdarg>
+#include <cstdio>
+
+
+#if IMGUI_WITH_DELEGATES
+
+namespace
+{
+	// Limit of batches waiting for replay, per thread.
+	constexpr int32 MaxPendingBatches = 1024;
+
+	// Batches that grew over this size release their memory before they are reused.
+	constexpr int32 MaxRetainedBatchSize = 64 * 1024;
+
+	void DeleteBatches(FImGuiDeferredBatch* Batch)
+	{
+		while (Batch)
+		{
+			FImGuiDeferredBatch* Next = Batch->Next;
+			delete Batch;
+			Batch = Next;
+		}
+	}
+
+	// Push a batch to a stack shared with one other thread.
+	void PushBatch(std::atomic<FImGuiDeferredBatch*>& Stack, FImGuiDeferredBatch* Batch)
+	{
+		Batch->Next = Stack.load(std::memory_order_relaxed);
+		while (!Stack.compare_exchange_weak(Batch->Next, Batch, std::memory_order_release, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	//----------------------------------------------------------------------------------------------------
+	// Command encoding
+	//----------------------------------------------------------------------------------------------------
+
+	template<typename T>
+	void Write(TArray<uint8>& Data, const T& Value)
+	{
+		Data.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
+
+	// Strings are stored with their length and null terminator. Null strings have length -1.
+	void WriteString(TArray<uint8>& Data, const char* String)
+	{
+		const int32 Length = String ? FCStringAnsi::Strlen(String) : -1;
+		Write(Data, Length);
+		if (String)
+		{
+			Data.Append(reinterpret_cast<const uint8*>(String), Length + 1);
+		}
+	}
+
+	void WriteFormat(TArray<uint8>& Data, const char* Fmt, va_list Args)
+	{
+		va_list ArgsCopy;
+		va_copy(ArgsCopy, Args);
+		const int32 Length = FMath::Max(vsnprintf(nullptr, 0, Fmt, ArgsCopy), 0);
+		va_end(ArgsCopy);
+
+		Write(Data, Length);
+		const int32 Offset = Data.AddUninitialized(Length + 1);
+		vsnprintf(reinterpret_cast<char*>(&Data[Offset]), Length + 1, Fmt, Args);
+		Data[Offset + Length] = 0;
+	}
+
+	void WriteFloats(TArray<uint8>& Data, const float* Values, int32 Count)
+	{
+		Count = Values ? FMath::Max(Count, 0) : 0;
+		Write(Data, Count);
+		Data.Append(reinterpret_cast<const uint8*>(Values), Count * sizeof(float));
+	}
+
+	struct FCommandReader
+	{
+		FCommandReader(const TArray<uint8>& Data)
+			: Position(Data.GetData())
+			, End(Data.GetData() + Data.Num())
+		{
+		}
+
+		bool IsAtEnd() const { return Position >= End; }
+
+		template<typename T>
+		T Read()
+		{
+			T Value;
+			FMemory::Memcpy(&Value, Position, sizeof(T));
+			Position += sizeof(T);
+			return Value;
+		}
+
+		const char* ReadString(int32* OutLength = nullptr)
+		{
+			const int32 Length = Read<int32>();
+			if (OutLength)
+			{
+				*OutLength = FMath::Max(Length, 0);
+			}
+
+			if (Length < 0)
+			{
+				return nullptr;
+			}
+
+			const char* String = reinterpret_cast<const char*>(Position);
+			Position += Length + 1;
+			return String;
+		}
+
+		// Floats are not aligned, so they are returned as bytes to read with GetFloat.
+		const uint8* ReadFloats(int32& OutCount)
+		{
+			OutCount = Read<int32>();
+			const uint8* Values = Position;
+			Position += OutCount * sizeof(float);
+			return Values;
+		}
+
+		static float GetFloat(void* Values, int Index)
+		{
+			float Value;
+			FMemory::Memcpy(&Value, static_cast<const uint8*>(Values) + Index * sizeof(float), sizeof(float));
+			return Value;
+		}
+
+		const uint8* Position;
+		const uint8* End;
+	};
+
+	struct FPlotArguments
+	{
+		const char* Label;
+		const uint8* Values;
+		int32 Count;
+		const char* Overlay;
+		float ScaleMin;
+		float ScaleMax;
+		ImVec2 GraphSize;
+
+		FPlotArguments(FCommandReader& Reader)
+		{
+			Label = Reader.ReadString();
+			Values = Reader.ReadFloats(Count);
+			Overlay = Reader.ReadString();
+			ScaleMin = Reader.Read<float>();
+			ScaleMax = Reader.Read<float>();
+			GraphSize = Reader.Read<ImVec2>();
+		}
+	};
+
+	void WritePlot(TArray<uint8>& Data, EImGuiDeferredCommand Command, const char* Label, const float* Values, int32 Count,
+		const char* Overlay, float ScaleMin, float ScaleMax, const ImVec2& GraphSize)
+	{
+		Write(Data, Command);
+		WriteString(Data, Label);
+		WriteFloats(Data, Values, Count);
+		WriteString(Data, Overlay);
+		Write(Data, ScaleMin);
+		Write(Data, ScaleMax);
+		Write(Data, GraphSize);
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// FImGuiDeferredThreadBuffer
+//----------------------------------------------------------------------------------------------------
+
+FImGuiDeferredThreadBuffer::~FImGuiDeferredThreadBuffer()
+{
+	DeleteBatches(Submitted.exchange(nullptr, std::memory_order_acquire));
+	DeleteBatches(Returned.exchange(nullptr, std::memory_order_acquire));
+	DeleteBatches(Free);
+}
+
+//----------------------------------------------------------------------------------------------------
+// FImGuiDeferredQueue
+//----------------------------------------------------------------------------------------------------
+
+FImGuiDeferredQueue& FImGuiDeferredQueue::Get()
+{
+	static FImGuiDeferredQueue Instance;
+	return Instance;
+}
+
+FImGuiDeferredQueue::~FImGuiDeferredQueue()
+{
+	// Collected batches are not in any stack of their buffers.
+	for (FImGuiDeferredBatch* Batch : Collected)
+	{
+		delete Batch;
+	}
+}
+
+FImGuiDeferredBatch* FImGuiDeferredQueue::AllocateBatch()
+{
+	FImGuiDeferredThreadBuffer* Buffer = &Buffers.GetThreadInstance();
+
+	if (!Buffer->Free)
+	{
+		Buffer->Free = Buffer->Returned.exchange(nullptr, std::memory_order_acquire);
+	}
+
+	FImGuiDeferredBatch* Batch = Buffer->Free;
+	if (Batch)
+	{
+		Buffer->Free = Batch->Next;
+
+		if (Batch->Data.Max() > MaxRetainedBatchSize)
+		{
+			Batch->Data.Empty();
+		}
+		else
+		{
+			Batch->Data.Reset();
+		}
+		Batch->WindowName.Reset();
+	}
+	else
+	{
+		Batch = new FImGuiDeferredBatch();
+		Batch->Owner = Buffer;
+	}
+
+	Batch->Next = nullptr;
+	return Batch;
+}
+
+void FImGuiDeferredQueue::Submit(FImGuiDeferredBatch* Batch)
+{
+	FImGuiDeferredThreadBuffer* Buffer = Batch->Owner;
+
+	if (Batch->Data.Num() == 0 || Buffer->NumPending.load(std::memory_order_relaxed) >= MaxPendingBatches)
+	{
+		Batch->Next = Buffer->Free;
+		Buffer->Free = Batch;
+		return;
+	}
+
+	Buffer->NumPending.fetch_add(1, std::memory_order_relaxed);
+	Batch->Sequence = NextSequence.fetch_add(1, std::memory_order_relaxed);
+	PushBatch(Buffer->Submitted, Batch);
+
+	Buffers.RequestActivation(TEXT("deferred commands submitted"));
+}
+
+void FImGuiDeferredQueue::Collect()
+{
+	// Batches from the last frame were replayed in all contexts, so they can go back to their threads.
+	for (FImGuiDeferredBatch* Batch : Collected)
+	{
+		FImGuiDeferredThreadBuffer* Buffer = Batch->Owner;
+		PushBatch(Buffer->Returned, Batch);
+		Buffer->NumPending.fetch_sub(1, std::memory_order_relaxed);
+	}
+	Collected.Reset();
+
+	Buffers.ForEach([this](FImGuiDeferredThreadBuffer& Buffer)
+	{
+		FImGuiDeferredBatch* Batch = Buffer.Submitted.exchange(nullptr, std::memory_order_acquire);
+		while (Batch)
+		{
+			Collected.Add(Batch);
+			Batch = Batch->Next;
+		}
+	});
+
+	Collected.Sort([](const FImGuiDeferredBatch& A, const FImGuiDeferredBatch& B) { return A.Sequence < B.Sequence; });
+}
+
+void FImGuiDeferredQueue::Replay(int32 ContextIndex) const
+{
+	for (const FImGuiDeferredBatch* Batch : Collected)
+	{
+		if (Batch->ContextIndex == ContextIndex || Batch->ContextIndex == MultiContextIndex)
+		{
+			ReplayBatch(*Batch);
+		}
+	}
+}
+
+void FImGuiDeferredQueue::ReplayBatch(const FImGuiDeferredBatch& Batch)
+{
+	const bool bHasWindow = Batch.WindowName.Num() > 0;
+	if (bHasWindow && !ImGui::Begin(Batch.WindowName.GetData()))
+	{
+		ImGui::End();
+		return;
+	}
+
+	// Tree nodes opened during replay and the depth of skipped tree nodes, when inside a collapsed one.
+	int32 OpenTreeNodes = 0;
+	int32 SkippedTreeNodes = 0;
+
+	FCommandReader Reader(Batch.Data);
+	while (!Reader.IsAtEnd())
+	{
+		const EImGuiDeferredCommand Command = Reader.Read<EImGuiDeferredCommand>();
+		switch (Command)
+		{
+		case EImGuiDeferredCommand::Text:
+		{
+			int32 Length;
+			const char* Text = Reader.ReadString(&Length);
+			if (!SkippedTreeNodes)
+			{
+				ImGui::TextUnformatted(Text, Text + Length);
+			}
+			break;
+		}
+		case EImGuiDeferredCommand::TextColored:
+		{
+			const ImVec4 Color = Reader.Read<ImVec4>();
+			int32 Length;
+			const char* Text = Reader.ReadString(&Length);
+			if (!SkippedTreeNodes)
+			{
+				ImGui::PushStyleColor(ImGuiCol_Text, Color);
+				ImGui::TextUnformatted(Text, Text + Length);
+				ImGui::PopStyleColor();
+			}
+			break;
+		}
+		case EImGuiDeferredCommand::ValueBool:
+		{
+			const char* Label = Reader.ReadString();
+			const bool bValue = Reader.Read<bool>();
+			if (!SkippedTreeNodes)
+			{
+				ImGui::Value(Label, bValue);
+			}
+			break;
+		}
+		case EImGuiDeferredCommand::ValueInt:
+		{
+			const char* Label = Reader.ReadString();
+			const int32 Value = Reader.Read<int32>();
+			if (!SkippedTreeNodes)
+			{
+				ImGui::Value(Label, Value);
+			}
+			break;
+		}
+		case EImGuiDeferredCommand::ValueFloat:
+		{
+			const char* Label = Reader.ReadString();
+			const float Value = Reader.Read<float>();
+			const char* Format = Reader.ReadString();
+			if (!SkippedTreeNodes)
+			{
+				ImGui::Value(Label, Value, Format);
+			}
+			break;
+		}
+		case EImGuiDeferredCommand::PlotLines:
+		{
+			const FPlotArguments Plot(Reader);
+			if (!SkippedTreeNodes)
+			{
+				ImGui::PlotLines(Plot.Label, &FCommandReader::GetFloat, const_cast<uint8*>(Plot.Values), Plot.Count, 0,
+					Plot.Overlay, Plot.ScaleMin, Plot.ScaleMax, Plot.GraphSize);
+			}
+			break;
+		}
+		case EImGuiDeferredCommand::PlotHistogram:
+		{
+			const FPlotArguments Plot(Reader);
+			if (!SkippedTreeNodes)
+			{
+				ImGui::PlotHistogram(Plot.Label, &FCommandReader::GetFloat, const_cast<uint8*>(Plot.Values), Plot.Count, 0,
+					Plot.Overlay, Plot.ScaleMin, Plot.ScaleMax, Plot.GraphSize);
+			}
+			break;
+		}
+		case EImGuiDeferredCommand::TreeNode:
+		{
+			const char* Label = Reader.ReadString();
+			if (SkippedTreeNodes)
+			{
+				SkippedTreeNodes++;
+			}
+			else if (ImGui::TreeNode(Label))
+			{
+				OpenTreeNodes++;
+			}
+			else
+			{
+				SkippedTreeNodes = 1;
+			}
+			break;
+		}
+		case EImGuiDeferredCommand::TreePop:
+		{
+			// Unmatched pops are ignored, so batches cannot affect the rest of the frame.
+			if (SkippedTreeNodes)
+			{
+				SkippedTreeNodes--;
+			}
+			else if (OpenTreeNodes)
+			{
+				ImGui::TreePop();
+				OpenTreeNodes--;
+			}
+			break;
+		}
+		case EImGuiDeferredCommand::Separator:
+		{
+			if (!SkippedTreeNodes)
+			{
+				ImGui::Separator();
+			}
+			break;
+		}
+		case EImGuiDeferredCommand::SameLine:
+		{
+			const float OffsetFromStartX = Reader.Read<float>();
+			const float Spacing = Reader.Read<float>();
+			if (!SkippedTreeNodes)
+			{
+				ImGui::SameLine(OffsetFromStartX, Spacing);
+			}
+			break;
+		}
+		}
+	}
+
+	while (OpenTreeNodes--)
+	{
+		ImGui::TreePop();
+	}
+
+	if (bHasWindow)
+	{
+		ImGui::End();
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// FImGuiDeferredCommands
+//----------------------------------------------------------------------------------------------------
+
+namespace
+{
+	void SetWindowName(FImGuiDeferredBatch& Batch, const char* WindowName)
+	{
+		if (WindowName && *WindowName)
+		{
+			Batch.WindowName.Append(WindowName, FCStringAnsi::Strlen(WindowName) + 1);
+		}
+	}
+}
+
+FImGuiDeferredCommands::FImGuiDeferredCommands(const char* WindowName)
+	: Batch(FImGuiDeferredQueue::Get().AllocateBatch())
+{
+	Batch->ContextIndex = FImGuiDeferredQueue::MultiContextIndex;
+	SetWindowName(*Batch, WindowName);
+}
+
+FImGuiDeferredCommands::FImGuiDeferredCommands(const UWorld* World, const char* WindowName)
+	: Batch(FImGuiDeferredQueue::Get().AllocateBatch())
+{
+	Batch->ContextIndex = Utilities::GetWorldContextIndex(World);
+	SetWindowName(*Batch, WindowName);
+}
+
+FImGuiDeferredCommands::~FImGuiDeferredCommands()
+{
+	FImGuiDeferredQueue::Get().Submit(Batch);
+}
+
+void FImGuiDeferredCommands::Text(const char* Fmt, ...)
+{
+	va_list Args;
+	va_start(Args, Fmt);
+	Write(Batch->Data, EImGuiDeferredCommand::Text);
+	WriteFormat(Batch->Data, Fmt, Args);
+	va_end(Args);
+}
+
+void FImGuiDeferredCommands::TextColored(const ImVec4& Color, const char* Fmt, ...)
+{
+	va_list Args;
+	va_start(Args, Fmt);
+	Write(Batch->Data, EImGuiDeferredCommand::TextColored);
+	Write(Batch->Data, Color);
+	WriteFormat(Batch->Data, Fmt, Args);
+	va_end(Args);
+}
+
+void FImGuiDeferredCommands::Value(const char* Label, bool bValue)
+{
+	Write(Batch->Data, EImGuiDeferredCommand::ValueBool);
+	WriteString(Batch->Data, Label);
+	Write(Batch->Data, bValue);
+}
+
+void FImGuiDeferredCommands::Value(const char* Label, int32 IntValue)
+{
+	Write(Batch->Data, EImGuiDeferredCommand::ValueInt);
+	WriteString(Batch->Data, Label);
+	Write(Batch->Data, IntValue);
+}
+
+void FImGuiDeferredCommands::Value(const char* Label, float FloatValue, const char* Format)
+{
+	Write(Batch->Data, EImGuiDeferredCommand::ValueFloat);
+	WriteString(Batch->Data, Label);
+	Write(Batch->Data, FloatValue);
+	WriteString(Batch->Data, Format);
+}
+
+void FImGuiDeferredCommands::PlotLines(const char* Label, const float* Values, int32 Count, const char* Overlay,
+	float ScaleMin, float ScaleMax, const ImVec2& GraphSize)
+{
+	WritePlot(Batch->Data, EImGuiDeferredCommand::PlotLines, Label, Values, Count, Overlay, ScaleMin, ScaleMax, GraphSize);
+}
+
+void FImGuiDeferredCommands::PlotHistogram(const char* Label, const float* Values, int32 Count, const char* Overlay,
+	float ScaleMin, float ScaleMax, const ImVec2& GraphSize)
+{
+	WritePlot(Batch->Data, EImGuiDeferredCommand::PlotHistogram, Label, Values, Count, Overlay, ScaleMin, ScaleMax, GraphSize);
+}
+
+void FImGuiDeferredCommands::TreeNode(const char* Label)
+{
+	Write(Batch->Data, EImGuiDeferredCommand::TreeNode);
+	WriteString(Batch->Data, Label);
+}
+
+void FImGuiDeferredCommands::TreePop()
+{
+	Write(Batch->Data, EImGuiDeferredCommand::TreePop);
+}
+
+void FImGuiDeferredCommands::Separator()
+{
+	Write(Batch->Data, EImGuiDeferredCommand::Separator);
+}
+
+void FImGuiDeferredCommands::SameLine(float OffsetFromStartX, float Spacing)
+{
+	Write(Batch->Data, EImGuiDeferredCommand::SameLine);
+	Write(Batch->Data, OffsetFromStartX);
+	Write(Batch->Data, Spacing);
+}
+
+#endif // IMGUI_WITH_DELEGATES
@@ -0,0 +1,115 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiDeferredCommands.h"
+#include "ImGuiThreadLocalRegistry.h"
+
+#include <Containers/Array.h>
+#include <Math/NumericLimits.h>
+
+#include <atomic>
+
+
+// Commands recorded by FImGuiDeferredCommands.
+enum class EImGuiDeferredCommand : uint8
+{
+	Text,
+	TextColored,
+	ValueBool,
+	ValueInt,
+	ValueFloat,
+	PlotLines,
+	PlotHistogram,
+	TreeNode,
+	TreePop,
+	Separator,
+	SameLine,
+};
+
+struct FImGuiDeferredThreadBuffer;
+
+// Commands recorded by a single FImGuiDeferredCommands instance. Batches are owned by thread buffers and reused after
+// they are replayed, so recording doesn't allocate once buffers have grown.
+struct FImGuiDeferredBatch
+{
+	// Encoded commands, each starting with EImGuiDeferredCommand and followed by its arguments.
+	TArray<uint8> Data;
+
+	// Null-terminated window name or empty to draw to the current window.
+	TArray<ANSICHAR> WindowName;
+
+	// Index of the target context or MultiContextIndex.
+	int32 ContextIndex = 0;
+
+	// Position in submission order.
+	uint64 Sequence = 0;
+
+	FImGuiDeferredThreadBuffer* Owner = nullptr;
+	FImGuiDeferredBatch* Next = nullptr;
+};
+
+// Batches of one thread, passed between that thread and the game thread through lock-free stacks. Each stack has one
+// thread pushing and the other taking all its batches at once, so they are free of ABA problems.
+struct FImGuiDeferredThreadBuffer
+{
+	FImGuiDeferredThreadBuffer() = default;
+	~FImGuiDeferredThreadBuffer();
+
+	FImGuiDeferredThreadBuffer(const FImGuiDeferredThreadBuffer&) = delete;
+	FImGuiDeferredThreadBuffer& operator=(const FImGuiDeferredThreadBuffer&) = delete;
+
+	// Batches submitted by the owning thread and not collected yet (the most recent first).
+	std::atomic<FImGuiDeferredBatch*> Submitted{ nullptr };
+
+	// Batches returned after replay, waiting to be reused by the owning thread.
+	std::atomic<FImGuiDeferredBatch*> Returned{ nullptr };
+
+	// Number of batches submitted and not returned yet.
+	std::atomic<int32> NumPending{ 0 };
+
+	// Batches ready to be reused, accessed only by the owning thread.
+	FImGuiDeferredBatch* Free = nullptr;
+};
+
+// Queue of batches recorded by FImGuiDeferredCommands on any thread and replayed in contexts on the game thread.
+class FImGuiDeferredQueue
+{
+public:
+
+	// Context index of batches replayed in every context.
+	static constexpr int32 MultiContextIndex = TNumericLimits<int32>::Max();
+
+	// Get the queue instance.
+	static FImGuiDeferredQueue& Get();
+
+	~FImGuiDeferredQueue();
+
+	// Get an empty batch of the calling thread.
+	FImGuiDeferredBatch* AllocateBatch();
+
+	// Submit a batch allocated on the calling thread. Batches are dropped, if too many of them are waiting for replay
+	// (e.g. while no context is drawn).
+	void Submit(FImGuiDeferredBatch* Batch);
+
+	// Take batches submitted since the last call for replay and return the previous ones to their threads. Should be
+	// called once per frame on the game thread.
+	void Collect();
+
+	// Replay collected batches targeting a context. Should be called on the game thread, in the context's debug frame.
+	void Replay(int32 ContextIndex) const;
+
+private:
+
+	FImGuiDeferredQueue() = default;
+
+	static void ReplayBatch(const FImGuiDeferredBatch& Batch);
+
+	// Buffers of all threads. Batches owned by buffers are deleted with them, except for the collected ones.
+	TImGuiThreadLocalRegistry<FImGuiDeferredThreadBuffer> Buffers;
+
+	std::atomic<uint64> NextSequence{ 0 };
+
+	// Batches collected for replay in the current frame, sorted by sequence.
+	TArray<FImGuiDeferredBatch*> Collected;
+};
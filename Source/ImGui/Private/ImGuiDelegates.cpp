@@ -2,10 +2,13 @@
 
 #include "ImGuiDelegates.h"
 #include "ImGuiDelegatesContainer.h"
+#include "ImGuiModuleManager.h"
 
 #include <Engine/World.h>
 
 
+#if IMGUI_WITH_DELEGATES
+
 FSimpleMulticastDelegate& FImGuiDelegates::OnWorldEarlyDebug()
 {
 	return OnWorldEarlyDebug(GWorld);
@@ -13,11 +16,13 @@ FSimpleMulticastDelegate& FImGuiDelegates::OnWorldEarlyDebug()
 
 FSimpleMulticastDelegate& FImGuiDelegates::OnWorldEarlyDebug(UWorld* World)
 {
+	FImGuiModuleManager::RequestDrawActivation(TEXT("draw delegate bound"));
 	return FImGuiDelegatesContainer::Get().OnWorldEarlyDebug(World);
 }
 
 FSimpleMulticastDelegate& FImGuiDelegates::OnMultiContextEarlyDebug()
 {
+	FImGuiModuleManager::RequestDrawActivation(TEXT("draw delegate bound"));
 	return FImGuiDelegatesContainer::Get().OnMultiContextEarlyDebug();
 }
 
@@ -28,10 +33,14 @@ FSimpleMulticastDelegate& FImGuiDelegates::OnWorldDebug()
 
 FSimpleMulticastDelegate& FImGuiDelegates::OnWorldDebug(UWorld* World)
 {
+	FImGuiModuleManager::RequestDrawActivation(TEXT("draw delegate bound"));
 	return FImGuiDelegatesContainer::Get().OnWorldDebug(World);
 }
 
 FSimpleMulticastDelegate& FImGuiDelegates::OnMultiContextDebug()
 {
+	FImGuiModuleManager::RequestDrawActivation(TEXT("draw delegate bound"));
 	return FImGuiDelegatesContainer::Get().OnMultiContextDebug();
 }
+
+#endif // IMGUI_WITH_DELEGATES
@@ -79,10 +79,39 @@ int32 FImGuiDelegatesContainer::GetContextIndex(UWorld* World)
 	return Utilities::GetWorldContextIndex(*World);
 }
 
+FImGuiWorldDelegates* FImGuiDelegatesContainer::FindWorldDelegates(int32 ContextIndex) const
+{
+	const int32 Slot = Utilities::GetContextSlot(ContextIndex);
+	return WorldDelegates.IsValidIndex(Slot) ? WorldDelegates[Slot].Get() : nullptr;
+}
+
+FImGuiWorldDelegates& FImGuiDelegatesContainer::GetWorldDelegates(int32 ContextIndex)
+{
+	const int32 Slot = Utilities::GetContextSlot(ContextIndex);
+	if (Slot < 0)
+	{
+		return InvalidWorldDelegates;
+	}
+
+	if (Slot >= WorldDelegates.Num())
+	{
+		WorldDelegates.SetNum(Slot + 1);
+	}
+
+	TUniquePtr<FImGuiWorldDelegates>& Delegates = WorldDelegates[Slot];
+	if (!Delegates)
+	{
+		Delegates = MakeUnique<FImGuiWorldDelegates>();
+	}
+
+	return *Delegates;
+}
+
 void FImGuiDelegatesContainer::Clear()
 {
-	WorldEarlyDebugDelegates.Empty();
-	WorldDebugDelegates.Empty();
+	WorldDelegates.Empty();
+	InvalidWorldDelegates.EarlyDebug.Clear();
+	InvalidWorldDelegates.Debug.Clear();
 	MultiContextEarlyDebugDelegate.Clear();
 	MultiContextDebugDelegate.Clear();
 }
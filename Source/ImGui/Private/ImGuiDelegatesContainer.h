@@ -2,14 +2,22 @@
 
 #pragma once
 
-#include <Containers/Map.h>
+#include <Containers/Array.h>
 #include <Delegates/Delegate.h>
+#include <Templates/UniquePtr.h>
 
 
 #if WITH_EDITOR
 struct FImGuiDelegatesContainerHandle;
 #endif
 
+// Delegates registered for a single context.
+struct FImGuiWorldDelegates
+{
+	FSimpleMulticastDelegate EarlyDebug;
+	FSimpleMulticastDelegate Debug;
+};
+
 struct FImGuiDelegatesContainer
 {
 public:
@@ -29,7 +37,7 @@ public:
 	FSimpleMulticastDelegate& OnWorldEarlyDebug(UWorld* World) { return OnWorldEarlyDebug(GetContextIndex(World)); }
 
 	// Get delegate to ImGui world early debug event from known context index.
-	FSimpleMulticastDelegate& OnWorldEarlyDebug(int32 ContextIndex) { return WorldEarlyDebugDelegates.FindOrAdd(ContextIndex); }
+	FSimpleMulticastDelegate& OnWorldEarlyDebug(int32 ContextIndex) { return GetWorldDelegates(ContextIndex).EarlyDebug; }
 
 	// Get delegate to ImGui multi-context early debug event.
 	FSimpleMulticastDelegate& OnMultiContextEarlyDebug() { return MultiContextEarlyDebugDelegate; }
@@ -38,19 +46,31 @@ public:
 	FSimpleMulticastDelegate& OnWorldDebug(UWorld* World) { return OnWorldDebug(GetContextIndex(World)); }
 
 	// Get delegate to ImGui world debug event from known context index.
-	FSimpleMulticastDelegate& OnWorldDebug(int32 ContextIndex) { return WorldDebugDelegates.FindOrAdd(ContextIndex); }
+	FSimpleMulticastDelegate& OnWorldDebug(int32 ContextIndex) { return GetWorldDelegates(ContextIndex).Debug; }
 
 	// Get delegate to ImGui multi-context debug event.
 	FSimpleMulticastDelegate& OnMultiContextDebug() { return MultiContextDebugDelegate; }
 
+	// Find delegates registered for a context without creating them. Delegates have stable addresses (also when the
+	// container is moved to a hot-reloaded module), so the result can be kept for as long as the module is loaded.
+	// @param ContextIndex - Index of the context
+	// @returns Delegates for that context or null, if nothing has been registered for it yet
+	FImGuiWorldDelegates* FindWorldDelegates(int32 ContextIndex) const;
+
 private:
 
 	int32 GetContextIndex(UWorld* World);
 
+	FImGuiWorldDelegates& GetWorldDelegates(int32 ContextIndex);
+
 	void Clear();
 
-	TMap<int32, FSimpleMulticastDelegate> WorldEarlyDebugDelegates;
-	TMap<int32, FSimpleMulticastDelegate> WorldDebugDelegates;
+	// Delegates of contexts indexed by context slots (see Utilities::GetContextSlot).
+	TArray<TUniquePtr<FImGuiWorldDelegates>> WorldDelegates;
+
+	// Registrations for worlds that cannot be resolved to a context. They are kept, but never broadcast.
+	FImGuiWorldDelegates InvalidWorldDelegates;
+
 	FSimpleMulticastDelegate MultiContextEarlyDebugDelegate;
 	FSimpleMulticastDelegate MultiContextDebugDelegate;
 };
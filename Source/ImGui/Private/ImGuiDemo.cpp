@@ -10,6 +10,7 @@
 // Demo copied (with minor modifications) from ImGui examples. See https://github.com/ocornut/imgui.
 void FImGuiDemo::DrawControls(int32 ContextIndex)
 {
+#if !IMGUI_RUNTIME_LITE
 	if (Properties.ShowDemo())
 	{
 		const int32 ContextBit = ContextIndex < 0 ? 0 : 1 << ContextIndex;
@@ -80,4 +81,5 @@ void FImGuiDemo::DrawControls(int32 ContextIndex)
 			ImGui::ShowDemoWindow();
 		}
 	}
+#endif // !IMGUI_RUNTIME_LITE
 }
@@ -5,9 +5,6 @@
 
 #if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 void FImGuiDrawList::CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform, const FSlateRotatedRect& VertexClippingRect) const
-#else
-void FImGuiDrawList::CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform) const
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 {
 	// Reset and reserve space in destination buffer.
 	OutVertexBuffer.SetNumUninitialized(ImGuiVertexBuffer.Size, false);
@@ -23,23 +20,78 @@ void FImGuiDrawList::CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const
 		SlateVertex.TexCoords[1] = ImGuiVertex.uv.y;
 		SlateVertex.TexCoords[2] = SlateVertex.TexCoords[3] = 1.f;
 
-#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 		const FVector2D VertexPosition = Transform.TransformPoint(ImGuiInterops::ToVector2D(ImGuiVertex.pos));
 		SlateVertex.Position[0] = VertexPosition.X;
 		SlateVertex.Position[1] = VertexPosition.Y;
 		SlateVertex.ClipRect = VertexClippingRect;
+
+		// Unpack ImU32 color.
+		SlateVertex.Color = ImGuiInterops::UnpackImU32Color(ImGuiVertex.col);
+	}
+}
 #else
-#if ENGINE_COMPATIBILITY_LEGACY_VECTOR2F
-		SlateVertex.Position = Transform.TransformPoint(ImGuiInterops::ToVector2D(ImGuiVertex.pos));
-#else
-		SlateVertex.Position = (FVector2f)Transform.TransformPoint(ImGuiInterops::ToVector2D(ImGuiVertex.pos));
-#endif // ENGINE_COMPATIBILITY_LEGACY_VECTOR2F
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+const TArray<FSlateVertex>& FImGuiDrawList::GetVertexData(const FSlateRenderTransform& Transform, TArray<FSlateVertex>& ScratchBuffer) const
+{
+	// The first widget painting this list after a transfer converts data for its transform.
+	if (!bHasCachedVertexData)
+	{
+		ConvertVertexData(CachedVertexBuffer, Transform);
+		CachedTransform = Transform;
+		bHasCachedVertexData = true;
+	}
+
+	if (Transform == CachedTransform)
+	{
+		return CachedVertexBuffer;
+	}
+
+	if (Transform.GetMatrix() == CachedTransform.GetMatrix())
+	{
+		// With the same linear part, transformed positions only differ by the difference in translation, while UVs and
+		// colors are the same.
+		using FPosition = decltype(FSlateVertex::Position);
+		const FPosition Offset = FPosition(Transform.GetTranslation() - CachedTransform.GetTranslation());
+
+		ScratchBuffer = CachedVertexBuffer;
+		for (FSlateVertex& SlateVertex : ScratchBuffer)
+		{
+			SlateVertex.Position += Offset;
+		}
+	}
+	else
+	{
+		ConvertVertexData(ScratchBuffer, Transform);
+	}
+
+	return ScratchBuffer;
+}
+
+void FImGuiDrawList::ConvertVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FSlateRenderTransform& Transform) const
+{
+	using FPosition = decltype(FSlateVertex::Position);
+
+	// Reset and reserve space in destination buffer.
+	OutVertexBuffer.SetNumUninitialized(ImGuiVertexBuffer.Size, false);
+
+	// Transform and copy vertex data in a single pass. Widgets round the translation of the transform, so panning keeps
+	// output pixel-perfect.
+	for (int Idx = 0; Idx < ImGuiVertexBuffer.Size; Idx++)
+	{
+		const ImDrawVert& ImGuiVertex = ImGuiVertexBuffer[Idx];
+		FSlateVertex& SlateVertex = OutVertexBuffer[Idx];
+
+		// Final UV is calculated in shader as XY * ZW, so we need set all components.
+		SlateVertex.TexCoords[0] = ImGuiVertex.uv.x;
+		SlateVertex.TexCoords[1] = ImGuiVertex.uv.y;
+		SlateVertex.TexCoords[2] = SlateVertex.TexCoords[3] = 1.f;
+
+		SlateVertex.Position = Transform.TransformPoint(FPosition(ImGuiVertex.pos.x, ImGuiVertex.pos.y));
 
 		// Unpack ImU32 color.
 		SlateVertex.Color = ImGuiInterops::UnpackImU32Color(ImGuiVertex.col);
 	}
 }
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 
 void FImGuiDrawList::CopyIndexData(TArray<SlateIndex>& OutIndexBuffer, const int32 StartIndex, const int32 NumElements) const
 {
@@ -60,4 +112,9 @@ void FImGuiDrawList::TransferDrawData(ImDrawList& Src)
 	Src.CmdBuffer.swap(ImGuiCommandBuffer);
 	Src.IdxBuffer.swap(ImGuiIndexBuffer);
 	Src.VtxBuffer.swap(ImGuiVertexBuffer);
+
+#if !ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	// New frame data need to be converted again.
+	bHasCachedVertexData = false;
+#endif // !ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 }
@@ -44,10 +44,13 @@ public:
 	// @param VertexClippingRect - Clipping rectangle for transformed Slate vertices
 	void CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform, const FSlateRotatedRect& VertexClippingRect) const;
 #else
-	// Transform and copy vertex data to target buffer (old data in the target buffer are replaced).
-	// @param OutVertexBuffer - Destination buffer
+	// Get vertex data transformed for Slate. Conversion result is cached until the next transfer, so widgets presenting
+	// the same context with the same transform share it. Transforms that only differ in translation reuse cached
+	// vertices and only offset their positions.
 	// @param Transform - Transform to apply to all vertices
-	void CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform) const;
+	// @param ScratchBuffer - Buffer used, if cached data cannot be shared for this transform
+	// @returns Transformed vertex data (either cached data or the scratch buffer)
+	const TArray<FSlateVertex>& GetVertexData(const FSlateRenderTransform& Transform, TArray<FSlateVertex>& ScratchBuffer) const;
 #endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 
 	// Transform and copy index data to target buffer (old data in the target buffer are replaced).
@@ -65,4 +68,12 @@ private:
 	ImVector<ImDrawCmd> ImGuiCommandBuffer;
 	ImVector<ImDrawIdx> ImGuiIndexBuffer;
 	ImVector<ImDrawVert> ImGuiVertexBuffer;
+
+#if !ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	void ConvertVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FSlateRenderTransform& Transform) const;
+
+	mutable TArray<FSlateVertex> CachedVertexBuffer;
+	mutable FSlateRenderTransform CachedTransform;
+	mutable bool bHasCachedVertexData = false;
+#endif // !ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 };
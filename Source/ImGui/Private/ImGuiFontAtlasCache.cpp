@@ -0,0 +1,433 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiFontAtlasCache.h"
+
+#include "VersionCompatibility.h"
+
+#include <Async/Async.h>
+#include <HAL/FileManager.h>
+#include <Hash/xxhash.h>
+#include <Misc/FileHelper.h>
+#include <Misc/ScopeLock.h>
+#include <Misc/Paths.h>
+#include <Serialization/MemoryReader.h>
+#include <Serialization/MemoryWriter.h>
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiFontAtlasCache, Log, All);
+
+namespace
+{
+	// Identifies cache files. Version needs to be increased every time the file layout changes.
+	constexpr uint32 CacheFileMagic = 0x41464749;
+	constexpr int32 CacheFileVersion = 1;
+
+	// Every change of fonts or their glyph ranges (which with glyphs rasterized on demand happens after every batch of
+	// new glyphs) produces a new key, so only a few most recently used files are kept.
+	constexpr int32 MaxCacheFiles = 8;
+
+	const TCHAR* const CacheFileExtension = TEXT(".imfontatlas");
+
+	FString GetCacheFileName(uint64 Key)
+	{
+		return FString::Printf(TEXT("%016llx%s"), Key, CacheFileExtension);
+	}
+
+	// Writable cache directory.
+	FString GetCacheDirectory()
+	{
+#if ENGINE_COMPATIBILITY_LEGACY_SAVED_DIR
+		const FString SavedDir = FPaths::GameSavedDir();
+#else
+		const FString SavedDir = FPaths::ProjectSavedDir();
+#endif
+		return FPaths::Combine(*SavedDir, TEXT("ImGui"), TEXT("FontAtlasCache"));
+	}
+
+	// Read-only cache directory for atlases shipped with the project.
+	FString GetShippedCacheDirectory()
+	{
+		return FPaths::Combine(*FPaths::ProjectContentDir(), TEXT("ImGui"), TEXT("FontAtlasCache"));
+	}
+
+	struct FCachedGlyph
+	{
+		uint32 Codepoint = 0;
+		float AdvanceX = 0.f;
+		float X0 = 0.f, Y0 = 0.f, X1 = 0.f, Y1 = 0.f;
+		float U0 = 0.f, V0 = 0.f, U1 = 0.f, V1 = 0.f;
+
+		friend FArchive& operator<<(FArchive& Ar, FCachedGlyph& Glyph)
+		{
+			return Ar << Glyph.Codepoint << Glyph.AdvanceX
+				<< Glyph.X0 << Glyph.Y0 << Glyph.X1 << Glyph.Y1
+				<< Glyph.U0 << Glyph.V0 << Glyph.U1 << Glyph.V1;
+		}
+	};
+
+	struct FCachedFont
+	{
+		float FontSize = 0.f;
+		float Ascent = 0.f;
+		float Descent = 0.f;
+		TArray<FCachedGlyph> Glyphs;
+
+		friend FArchive& operator<<(FArchive& Ar, FCachedFont& Font)
+		{
+			return Ar << Font.FontSize << Font.Ascent << Font.Descent << Font.Glyphs;
+		}
+	};
+
+	struct FCachedCustomRect
+	{
+		uint16 Width = 0, Height = 0;
+		uint16 X = 0, Y = 0;
+		uint32 GlyphID = 0;
+		float GlyphAdvanceX = 0.f;
+		float GlyphOffsetX = 0.f, GlyphOffsetY = 0.f;
+		int32 FontIndex = INDEX_NONE;
+
+		friend FArchive& operator<<(FArchive& Ar, FCachedCustomRect& Rect)
+		{
+			return Ar << Rect.Width << Rect.Height << Rect.X << Rect.Y << Rect.GlyphID << Rect.GlyphAdvanceX
+				<< Rect.GlyphOffsetX << Rect.GlyphOffsetY << Rect.FontIndex;
+		}
+	};
+
+	struct FCachedAtlas
+	{
+		int32 TexWidth = 0;
+		int32 TexHeight = 0;
+		float TexUvWhitePixelX = 0.f, TexUvWhitePixelY = 0.f;
+		TArray<float> TexUvLines;
+		int32 PackIdMouseCursors = INDEX_NONE;
+		int32 PackIdLines = INDEX_NONE;
+		TArray<FCachedCustomRect> CustomRects;
+		TArray<FCachedFont> Fonts;
+		TArray<uint8> Pixels;
+
+		friend FArchive& operator<<(FArchive& Ar, FCachedAtlas& Atlas)
+		{
+			return Ar << Atlas.TexWidth << Atlas.TexHeight << Atlas.TexUvWhitePixelX << Atlas.TexUvWhitePixelY
+				<< Atlas.TexUvLines << Atlas.PackIdMouseCursors << Atlas.PackIdLines << Atlas.CustomRects
+				<< Atlas.Fonts << Atlas.Pixels;
+		}
+
+		// Check whether cached data are complete and match fonts that are added to the atlas.
+		bool IsValidFor(const ImFontAtlas& FontAtlas) const
+		{
+			return TexWidth > 0 && TexHeight > 0
+				&& Pixels.Num() == TexWidth * TexHeight
+				&& TexUvLines.Num() == (IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1) * 4
+				&& CustomRects.Num() >= FontAtlas.CustomRects.Size
+				&& Fonts.Num() == FontAtlas.Fonts.Size
+				&& !Fonts.ContainsByPredicate([](const FCachedFont& Font) { return Font.Glyphs.Num() == 0 || Font.Glyphs.Num() >= 0xFFFF; })
+				&& !CustomRects.ContainsByPredicate([&](const FCachedCustomRect& Rect) { return Rect.FontIndex >= Fonts.Num(); });
+		}
+	};
+
+	void HashConfig(FXxHash64Builder& Hash, const ImFontConfig& Config, int32 FontIndex)
+	{
+		auto HashValue = [&Hash](const auto& Value) { Hash.Update(&Value, sizeof(Value)); };
+
+		HashValue(Config.FontDataSize);
+		Hash.Update(Config.FontData, Config.FontDataSize);
+		HashValue(Config.FontNo);
+		HashValue(Config.SizePixels);
+		HashValue(Config.OversampleH);
+		HashValue(Config.OversampleV);
+		HashValue(Config.PixelSnapH);
+		HashValue(Config.GlyphExtraSpacing.x);
+		HashValue(Config.GlyphExtraSpacing.y);
+		HashValue(Config.GlyphOffset.x);
+		HashValue(Config.GlyphOffset.y);
+		HashValue(Config.GlyphMinAdvanceX);
+		HashValue(Config.GlyphMaxAdvanceX);
+		HashValue(Config.MergeMode);
+		HashValue(Config.FontBuilderFlags);
+		HashValue(Config.RasterizerMultiply);
+		HashValue(Config.RasterizerDensity);
+		HashValue(Config.EllipsisChar);
+		HashValue(FontIndex);
+
+		// Glyph ranges are hashed by content, with null ranges meaning defaults.
+		if (Config.GlyphRanges)
+		{
+			const ImWchar* Range = Config.GlyphRanges;
+			while (Range[0] && Range[1])
+			{
+				Range += 2;
+			}
+			Hash.Update(Config.GlyphRanges, (Range - Config.GlyphRanges) * sizeof(ImWchar));
+		}
+		HashValue(ImWchar(0));
+	}
+
+	bool LoadCacheFile(uint64 Key, TArray<uint8>& OutData)
+	{
+		const FString FileName = GetCacheFileName(Key);
+		for (const FString& Directory : { GetCacheDirectory(), GetShippedCacheDirectory() })
+		{
+			const FString FilePath = FPaths::Combine(Directory, FileName);
+			if (FPaths::FileExists(FilePath) && FFileHelper::LoadFileToArray(OutData, *FilePath))
+			{
+				// Time stamps of files in the writable directory track their use, so eviction can keep recently used files.
+				if (Directory == GetCacheDirectory())
+				{
+					IFileManager::Get().SetTimeStamp(*FilePath, FDateTime::UtcNow());
+				}
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Delete the least recently used files over the limit from the writable cache directory.
+	void EvictCacheFiles()
+	{
+		const FString Directory = GetCacheDirectory();
+
+		TArray<FString> FileNames;
+		IFileManager::Get().FindFiles(FileNames, *Directory, CacheFileExtension);
+		if (FileNames.Num() <= MaxCacheFiles)
+		{
+			return;
+		}
+
+		TArray<TPair<FDateTime, FString>> Files;
+		for (const FString& FileName : FileNames)
+		{
+			const FString FilePath = FPaths::Combine(Directory, FileName);
+			Files.Emplace(IFileManager::Get().GetTimeStamp(*FilePath), FilePath);
+		}
+
+		Files.Sort([](const TPair<FDateTime, FString>& A, const TPair<FDateTime, FString>& B) { return A.Key > B.Key; });
+		for (int32 Index = MaxCacheFiles; Index < Files.Num(); Index++)
+		{
+			IFileManager::Get().Delete(*Files[Index].Value, false, false, true);
+		}
+	}
+
+	// Tasks writing cache files. Saves can be requested from the game thread and from background atlas builds.
+	FCriticalSection PendingSavesLock;
+	TArray<TFuture<void>> PendingSaves;
+}
+
+namespace ImGuiFontAtlasCache
+{
+	uint64 CalculateKey(const ImFontAtlas& FontAtlas, float DPIScale)
+	{
+		FXxHash64Builder Hash;
+		auto HashValue = [&Hash](const auto& Value) { Hash.Update(&Value, sizeof(Value)); };
+
+		HashValue(CacheFileVersion);
+		HashValue(IMGUI_VERSION_NUM);
+		HashValue(DPIScale);
+		HashValue(FontAtlas.Flags);
+		HashValue(FontAtlas.TexDesiredWidth);
+		HashValue(FontAtlas.TexGlyphPadding);
+		HashValue(FontAtlas.FontBuilderFlags);
+
+		for (const ImFontConfig& Config : FontAtlas.ConfigData)
+		{
+			HashConfig(Hash, Config, FontAtlas.Fonts.index_from_ptr(FontAtlas.Fonts.find(Config.DstFont)));
+		}
+
+		// Custom rectangles are added by users, so we need to take their input into account.
+		for (const ImFontAtlasCustomRect& Rect : FontAtlas.CustomRects)
+		{
+			HashValue(Rect.Width);
+			HashValue(Rect.Height);
+			HashValue(Rect.GlyphID);
+			HashValue(Rect.GlyphAdvanceX);
+			HashValue(Rect.GlyphOffset.x);
+			HashValue(Rect.GlyphOffset.y);
+		}
+
+		return Hash.Finalize().Hash;
+	}
+
+	bool Load(uint64 Key, ImFontAtlas& FontAtlas)
+	{
+		TArray<uint8> FileData;
+		if (!LoadCacheFile(Key, FileData))
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(FileData);
+
+		uint32 Magic = 0;
+		int32 Version = 0;
+		uint64 FileKey = 0;
+		Reader << Magic << Version << FileKey;
+
+		if (Magic != CacheFileMagic || Version != CacheFileVersion || FileKey != Key)
+		{
+			UE_LOG(LogImGuiFontAtlasCache, Log, TEXT("Ignoring outdated font atlas cache file '%s'."), *GetCacheFileName(Key));
+			return false;
+		}
+
+		FCachedAtlas Atlas;
+		Reader << Atlas;
+
+		if (Reader.IsError() || !Reader.AtEnd() || !Atlas.IsValidFor(FontAtlas))
+		{
+			UE_LOG(LogImGuiFontAtlasCache, Warning, TEXT("Ignoring invalid font atlas cache file '%s'."), *GetCacheFileName(Key));
+			return false;
+		}
+
+		// Restore texture data.
+		FontAtlas.ClearTexData();
+		FontAtlas.TexWidth = Atlas.TexWidth;
+		FontAtlas.TexHeight = Atlas.TexHeight;
+		FontAtlas.TexUvScale = ImVec2(1.f / Atlas.TexWidth, 1.f / Atlas.TexHeight);
+		FontAtlas.TexUvWhitePixel = ImVec2(Atlas.TexUvWhitePixelX, Atlas.TexUvWhitePixelY);
+		for (int32 Index = 0; Index <= IM_DRAWLIST_TEX_LINES_WIDTH_MAX; Index++)
+		{
+			const float* UV = &Atlas.TexUvLines[Index * 4];
+			FontAtlas.TexUvLines[Index] = ImVec4(UV[0], UV[1], UV[2], UV[3]);
+		}
+
+		FontAtlas.TexPixelsAlpha8 = static_cast<unsigned char*>(IM_ALLOC(Atlas.Pixels.Num()));
+		FMemory::Memcpy(FontAtlas.TexPixelsAlpha8, Atlas.Pixels.GetData(), Atlas.Pixels.Num());
+		FontAtlas.TexPixelsUseColors = false;
+
+		// Restore packed rectangles used for custom data (white pixel, mouse cursors, baked lines and user rectangles).
+		FontAtlas.PackIdMouseCursors = Atlas.PackIdMouseCursors;
+		FontAtlas.PackIdLines = Atlas.PackIdLines;
+		FontAtlas.CustomRects.resize(Atlas.CustomRects.Num());
+		for (int32 Index = 0; Index < Atlas.CustomRects.Num(); Index++)
+		{
+			const FCachedCustomRect& Cached = Atlas.CustomRects[Index];
+			ImFontAtlasCustomRect& Rect = FontAtlas.CustomRects[Index];
+			Rect.Width = Cached.Width;
+			Rect.Height = Cached.Height;
+			Rect.X = Cached.X;
+			Rect.Y = Cached.Y;
+			Rect.GlyphID = Cached.GlyphID;
+			Rect.GlyphAdvanceX = Cached.GlyphAdvanceX;
+			Rect.GlyphOffset = ImVec2(Cached.GlyphOffsetX, Cached.GlyphOffsetY);
+			Rect.Font = (Cached.FontIndex != INDEX_NONE) ? FontAtlas.Fonts[Cached.FontIndex] : nullptr;
+		}
+
+		// Restore fonts. Glyphs are stored after applying font config adjustments, so we add them without config.
+		for (int32 Index = 0; Index < Atlas.Fonts.Num(); Index++)
+		{
+			const FCachedFont& Cached = Atlas.Fonts[Index];
+			ImFont* Font = FontAtlas.Fonts[Index];
+
+			Font->ClearOutputData();
+			Font->FontSize = Cached.FontSize;
+			Font->ContainerAtlas = &FontAtlas;
+			Font->Ascent = Cached.Ascent;
+			Font->Descent = Cached.Descent;
+
+			for (const FCachedGlyph& Glyph : Cached.Glyphs)
+			{
+				Font->AddGlyph(nullptr, (ImWchar)Glyph.Codepoint, Glyph.X0, Glyph.Y0, Glyph.X1, Glyph.Y1,
+					Glyph.U0, Glyph.V0, Glyph.U1, Glyph.V1, Glyph.AdvanceX);
+			}
+
+			Font->BuildLookupTable();
+		}
+
+		FontAtlas.TexReady = true;
+
+		return true;
+	}
+
+	bool Save(uint64 Key, const ImFontAtlas& FontAtlas)
+	{
+		// Colored glyphs would require RGBA data, but atlases built with the default builder use only alpha.
+		if (!FontAtlas.IsBuilt() || !FontAtlas.TexPixelsAlpha8 || FontAtlas.TexPixelsUseColors)
+		{
+			return false;
+		}
+
+		FCachedAtlas Atlas;
+		Atlas.TexWidth = FontAtlas.TexWidth;
+		Atlas.TexHeight = FontAtlas.TexHeight;
+		Atlas.TexUvWhitePixelX = FontAtlas.TexUvWhitePixel.x;
+		Atlas.TexUvWhitePixelY = FontAtlas.TexUvWhitePixel.y;
+		for (const ImVec4& UV : FontAtlas.TexUvLines)
+		{
+			Atlas.TexUvLines.Append({ UV.x, UV.y, UV.z, UV.w });
+		}
+		Atlas.PackIdMouseCursors = FontAtlas.PackIdMouseCursors;
+		Atlas.PackIdLines = FontAtlas.PackIdLines;
+		Atlas.Pixels.Append(FontAtlas.TexPixelsAlpha8, FontAtlas.TexWidth * FontAtlas.TexHeight);
+
+		for (const ImFontAtlasCustomRect& Rect : FontAtlas.CustomRects)
+		{
+			FCachedCustomRect& Cached = Atlas.CustomRects.AddDefaulted_GetRef();
+			Cached.Width = Rect.Width;
+			Cached.Height = Rect.Height;
+			Cached.X = Rect.X;
+			Cached.Y = Rect.Y;
+			Cached.GlyphID = Rect.GlyphID;
+			Cached.GlyphAdvanceX = Rect.GlyphAdvanceX;
+			Cached.GlyphOffsetX = Rect.GlyphOffset.x;
+			Cached.GlyphOffsetY = Rect.GlyphOffset.y;
+			Cached.FontIndex = Rect.Font ? FontAtlas.Fonts.index_from_ptr(FontAtlas.Fonts.find(Rect.Font)) : INDEX_NONE;
+		}
+
+		for (const ImFont* Font : FontAtlas.Fonts)
+		{
+			FCachedFont& Cached = Atlas.Fonts.AddDefaulted_GetRef();
+			Cached.FontSize = Font->FontSize;
+			Cached.Ascent = Font->Ascent;
+			Cached.Descent = Font->Descent;
+
+			// Skip the tab glyph which is synthesized when building lookup tables.
+			for (const ImFontGlyph& Glyph : Font->Glyphs)
+			{
+				if (Glyph.Codepoint != '\t')
+				{
+					Cached.Glyphs.Add({ Glyph.Codepoint, Glyph.AdvanceX, Glyph.X0, Glyph.Y0, Glyph.X1, Glyph.Y1,
+						Glyph.U0, Glyph.V0, Glyph.U1, Glyph.V1 });
+				}
+			}
+		}
+
+		TArray<uint8> FileData;
+		FMemoryWriter Writer(FileData);
+
+		uint32 Magic = CacheFileMagic;
+		int32 Version = CacheFileVersion;
+		Writer << Magic << Version << Key << Atlas;
+
+		// Atlases with large fonts produce files of several megabytes, so they are written in the background.
+		TFuture<void> SaveTask = Async(EAsyncExecution::ThreadPool, [Key, FileData = MoveTemp(FileData)]()
+		{
+			const FString FilePath = FPaths::Combine(GetCacheDirectory(), GetCacheFileName(Key));
+			if (!FFileHelper::SaveArrayToFile(FileData, *FilePath))
+			{
+				UE_LOG(LogImGuiFontAtlasCache, Warning, TEXT("Failed to save font atlas cache file '%s'."), *FilePath);
+				return;
+			}
+
+			EvictCacheFiles();
+		});
+
+		FScopeLock Lock(&PendingSavesLock);
+		PendingSaves.RemoveAll([](const TFuture<void>& Task) { return Task.IsReady(); });
+		PendingSaves.Add(MoveTemp(SaveTask));
+
+		return true;
+	}
+
+	void WaitForPendingSaves()
+	{
+		TArray<TFuture<void>> Tasks;
+		{
+			FScopeLock Lock(&PendingSavesLock);
+			Tasks = MoveTemp(PendingSaves);
+		}
+
+		for (TFuture<void>& Task : Tasks)
+		{
+			Task.Wait();
+		}
+	}
+}
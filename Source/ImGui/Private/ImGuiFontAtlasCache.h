@@ -0,0 +1,42 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+
+// Persistent cache of built font atlases. Building atlases with large fonts can take a significant time, so we store
+// atlas pixels, glyph tables and font metrics on disk and load them during subsequent launches, when the atlas input
+// didn't change. Cache files are written in the background to the Saved/ImGui/FontAtlasCache directory, which keeps
+// only a few most recently used files. Files placed in the Content/ImGui/FontAtlasCache directory are also used and
+// are staged with packaged builds, what allows to ship pre-built atlases.
+//
+// Dear ImGui doesn't apply kerning in this version, so glyph tables and metrics describe the fonts completely.
+namespace ImGuiFontAtlasCache
+{
+	// Calculate a key identifying the atlas output. It is based on font data, font configs, atlas build parameters and
+	// the DPI scale. Needs to be called after all fonts are added to the atlas but before it is built.
+	// @param FontAtlas - Font atlas with added fonts
+	// @param DPIScale - DPI scale used to configure fonts
+	// @returns Key identifying the atlas output
+	uint64 CalculateKey(const ImFontAtlas& FontAtlas, float DPIScale);
+
+	// Try to load the atlas output from the cache. Fonts need to be added to the atlas in the same order as when it was
+	// saved, which is guaranteed, if the key matches. On success the atlas is built and ready to use.
+	// @param Key - The key identifying the atlas output
+	// @param FontAtlas - Font atlas with added fonts, which is not yet built
+	// @returns True, if the atlas was loaded from the cache
+	bool Load(uint64 Key, ImFontAtlas& FontAtlas);
+
+	// Save the atlas output in the cache. Data are copied from the atlas and written to a file in the background. After
+	// that, the least recently used files over the cache limit are deleted.
+	// @param Key - The key identifying the atlas output
+	// @param FontAtlas - Built font atlas
+	// @returns True, if the atlas can be saved
+	bool Save(uint64 Key, const ImFontAtlas& FontAtlas);
+
+	// Wait until all files are saved. Needs to be called before the module is unloaded.
+	void WaitForPendingSaves();
+}
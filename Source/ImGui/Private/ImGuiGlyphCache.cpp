@@ -0,0 +1,153 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiGlyphCache.h"
+
+
+namespace
+{
+	constexpr int32 NumCodepoints = IM_UNICODE_CODEPOINT_MAX + 1;
+
+	// Glyphs that are always resident: Basic Latin printable characters.
+	constexpr uint32 ResidentRangeBegin = 0x0020;
+	constexpr uint32 ResidentRangeEnd = 0x007E;
+}
+
+FImGuiGlyphCache::FImGuiGlyphCache()
+{
+	ResetGlyphs();
+}
+
+void FImGuiGlyphCache::SetEnabled(bool bInEnabled)
+{
+	if (bEnabled != bInEnabled)
+	{
+		bEnabled = bInEnabled;
+		ResetGlyphs();
+	}
+}
+
+void FImGuiGlyphCache::BeginBuild()
+{
+	SourceRanges.Reset();
+	BuiltRanges.Reset();
+
+	// Sources can change between builds, so we need to re-evaluate glyphs that were previously unavailable.
+	UnavailableGlyphs.Init(false, NumCodepoints);
+}
+
+void FImGuiGlyphCache::SetupFontConfig(ImFontConfig& FontConfig)
+{
+	// Fonts without explicit ranges use ImGui defaults (Latin) that are small enough to be built in full.
+	if (!bEnabled || !FontConfig.GlyphRanges)
+	{
+		return;
+	}
+
+	FSourceRanges& Source = SourceRanges.AddDefaulted_GetRef();
+	Source.Ranges = FontConfig.GlyphRanges;
+
+	// Narrow source ranges to resident glyphs.
+	TArray<ImWchar>& Ranges = BuiltRanges.AddDefaulted_GetRef();
+	for (const ImWchar* Range = FontConfig.GlyphRanges; Range[0] && Range[1]; Range += 2)
+	{
+		int32 RangeBegin = INDEX_NONE;
+		for (uint32 Codepoint = Range[0]; Codepoint <= Range[1] && Codepoint < (uint32)NumCodepoints; Codepoint++)
+		{
+			if (ResidentGlyphs[Codepoint])
+			{
+				if (RangeBegin == INDEX_NONE)
+				{
+					RangeBegin = Codepoint;
+				}
+			}
+			else if (RangeBegin != INDEX_NONE)
+			{
+				Ranges.Append({ (ImWchar)RangeBegin, (ImWchar)(Codepoint - 1) });
+				RangeBegin = INDEX_NONE;
+			}
+		}
+
+		if (RangeBegin != INDEX_NONE)
+		{
+			Ranges.Append({ (ImWchar)RangeBegin, Range[1] });
+		}
+	}
+
+	// Fonts need at least one glyph to set up the fallback, so in rare cases when none of the source glyphs is resident,
+	// we keep the full ranges. Merged fonts have no such requirement.
+	if (Ranges.Num() > 0 || FontConfig.MergeMode)
+	{
+		Ranges.Add(0);
+		FontConfig.GlyphRanges = Ranges.GetData();
+	}
+}
+
+void FImGuiGlyphCache::RequestGlyph(uint32 Codepoint)
+{
+	if (!bEnabled || Codepoint >= (uint32)NumCodepoints
+		|| ResidentGlyphs[Codepoint] || PendingGlyphs[Codepoint] || UnavailableGlyphs[Codepoint])
+	{
+		return;
+	}
+
+	const bool bAvailable = SourceRanges.ContainsByPredicate([Codepoint](const FSourceRanges& Source)
+	{
+		return Source.Contains(Codepoint);
+	});
+
+	if (bAvailable)
+	{
+		PendingGlyphs[Codepoint] = true;
+		NumPendingGlyphs++;
+	}
+	else
+	{
+		// Remember, so we don't need to scan source ranges every time when text with this glyph is rendered.
+		UnavailableGlyphs[Codepoint] = true;
+	}
+}
+
+int32 FImGuiGlyphCache::CommitPendingGlyphs()
+{
+	const int32 NumCommitted = NumPendingGlyphs;
+	if (NumCommitted > 0)
+	{
+		ResidentGlyphs.CombineWithBitwiseOR(PendingGlyphs, EBitwiseOperatorFlags::MaintainSize);
+		PendingGlyphs.Init(false, NumCodepoints);
+		NumPendingGlyphs = 0;
+	}
+	return NumCommitted;
+}
+
+void FImGuiGlyphCache::ResetGlyphs()
+{
+	ResidentGlyphs.Init(false, NumCodepoints);
+	ResidentGlyphs.SetRange(ResidentRangeBegin, ResidentRangeEnd - ResidentRangeBegin + 1, true);
+
+	PendingGlyphs.Init(false, NumCodepoints);
+	UnavailableGlyphs.Init(false, NumCodepoints);
+	NumPendingGlyphs = 0;
+}
+
+bool FImGuiGlyphCache::FSourceRanges::Contains(uint32 Codepoint) const
+{
+	for (const ImWchar* Range = Ranges; Range[0] && Range[1]; Range += 2)
+	{
+		if (Codepoint >= Range[0] && Codepoint <= Range[1])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+namespace ImGuiGlyphCache
+{
+	void OnMissingGlyph(const ImFont* Font, unsigned int Codepoint)
+	{
+		if (Font && Font->ContainerAtlas && Font->ContainerAtlas->UserData)
+		{
+			static_cast<FImGuiGlyphCache*>(Font->ContainerAtlas->UserData)->RequestGlyph(Codepoint);
+		}
+	}
+}
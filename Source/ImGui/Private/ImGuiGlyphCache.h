@@ -0,0 +1,80 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <Containers/BitArray.h>
+
+#include <imgui.h>
+
+
+// Tracks glyphs that are resident in the font atlas and collects glyphs that were requested by text rendering but are
+// missing from it. With on-demand rasterization enabled, fonts are built only with resident glyphs (Basic Latin and
+// glyphs requested so far), which keeps the atlas small for fonts with large glyph ranges (e.g. CJK). Missing glyphs
+// are committed in batches, which the context manager uses to trigger atlas rebuilds.
+class FImGuiGlyphCache
+{
+public:
+
+	FImGuiGlyphCache();
+
+	FImGuiGlyphCache(const FImGuiGlyphCache&) = delete;
+	FImGuiGlyphCache& operator=(const FImGuiGlyphCache&) = delete;
+
+	FImGuiGlyphCache(FImGuiGlyphCache&&) = delete;
+	FImGuiGlyphCache& operator=(FImGuiGlyphCache&&) = delete;
+
+	// Whether glyphs are rasterized on demand. If disabled, fonts are built with their full glyph ranges.
+	bool IsEnabled() const { return bEnabled; }
+
+	// Enable or disable on-demand rasterization. Disabling it releases resident and pending glyph information.
+	void SetEnabled(bool bInEnabled);
+
+	// Prepare a font config before adding it to the atlas. If enabled, glyph ranges of the config are narrowed to glyphs
+	// that are resident in this cache. Narrowed ranges are owned by this cache and stay valid until the next build.
+	// @param FontConfig - Copy of the source font config that will be passed to the atlas
+	void SetupFontConfig(ImFontConfig& FontConfig);
+
+	// Mark the beginning of a new atlas build, releasing glyph ranges created for the previous one.
+	void BeginBuild();
+
+	// Request a glyph that was missing during text rendering. Glyphs that none of the fonts can provide are ignored.
+	// @param Codepoint - Code point of the missing glyph
+	void RequestGlyph(uint32 Codepoint);
+
+	// Whether there are requested glyphs waiting to be committed.
+	bool HasPendingGlyphs() const { return NumPendingGlyphs > 0; }
+
+	// Move pending glyphs to the resident set, so they are included in the next atlas build.
+	// @returns The number of committed glyphs
+	int32 CommitPendingGlyphs();
+
+private:
+
+	// Glyph ranges that fonts can provide, as requested in the source configs.
+	struct FSourceRanges
+	{
+		const ImWchar* Ranges = nullptr;
+
+		bool Contains(uint32 Codepoint) const;
+	};
+
+	void ResetGlyphs();
+
+	TArray<FSourceRanges> SourceRanges;
+	TArray<TArray<ImWchar>> BuiltRanges;
+
+	TBitArray<> ResidentGlyphs;
+	TBitArray<> PendingGlyphs;
+	TBitArray<> UnavailableGlyphs;
+
+	int32 NumPendingGlyphs = 0;
+
+	bool bEnabled = false;
+};
+
+namespace ImGuiGlyphCache
+{
+	// Entry point for IMGUI_ON_MISSING_GLYPH hook (see imconfig.h). Forwards requests to the glyph cache bound to
+	// the font atlas via ImFontAtlas::UserData.
+	void OnMissingGlyph(const ImFont* Font, unsigned int Codepoint);
+}
@@ -3,6 +3,7 @@
 #include "ImGuiImplementation.h"
 
 #include <CoreMinimal.h>
+#include <Async/ParallelFor.h>
 
 // For convenience and easy access to the ImGui source code, we build it as part of this module.
 // We don't need to define IMGUI_API manually because it is already done for this module.
@@ -60,8 +61,39 @@ static FImGuiContextHandle ImGuiContextPtrHandle(ImGuiContextPtr);
 #include "ImGuiInteroperability.h"
 
 
+namespace ImGuiFontBuilder
+{
+	void ParallelFor(int Count, void (*Func)(int Index, void* UserData), void* UserData)
+	{
+		// Called by font atlas builds, so worker threads can't access the current context either.
+		::ParallelFor(Count, [Func, UserData](int32 Index)
+		{
+			ImGuiImplementation::FContextFreeScope ContextFreeScope;
+			Func(Index, UserData);
+		});
+	}
+}
+
 namespace ImGuiImplementation
 {
+	// Scopes can be nested, e.g. when a background build runs a parallel loop partly on its own thread.
+	static thread_local int32 ContextFreeScopeDepth = 0;
+
+	FContextFreeScope::FContextFreeScope()
+	{
+		ContextFreeScopeDepth++;
+	}
+
+	FContextFreeScope::~FContextFreeScope()
+	{
+		ContextFreeScopeDepth--;
+	}
+
+	bool IsContextFreeThread()
+	{
+		return ContextFreeScopeDepth > 0;
+	}
+
 #if WITH_EDITOR
 	FImGuiContextHandle& GetContextHandle()
 	{
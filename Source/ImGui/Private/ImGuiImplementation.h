@@ -7,6 +7,17 @@ struct FImGuiContextHandle;
 // Gives access to selected ImGui implementation features.
 namespace ImGuiImplementation
 {
+	// Marks the calling thread as context-free while in scope, so ImGui allocations made by it don't access the current
+	// context, which belongs to the game thread. Used by font atlas builds, which can run on worker threads.
+	struct FContextFreeScope
+	{
+		FContextFreeScope();
+		~FContextFreeScope();
+
+		FContextFreeScope(const FContextFreeScope&) = delete;
+		FContextFreeScope& operator=(const FContextFreeScope&) = delete;
+	};
+
 #if WITH_EDITOR
 	// Get the handle to the ImGui Context pointer.
 	FImGuiContextHandle& GetContextHandle();
@@ -0,0 +1,136 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiIniFile.h"
+
+#include <Async/Async.h>
+#include <HAL/FileManager.h>
+#include <Hash/xxhash.h>
+#include <Misc/CommandLine.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Parse.h>
+
+#include <imgui.h>
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiIniFile, Log, All);
+
+// State shared with the background task. Data requested while the task is writing replace older pending data, so the
+// task only writes the latest version when it is done.
+struct FImGuiIniFile::FWriteState
+{
+	FCriticalSection Lock;
+	TArray<uint8> PendingData;
+	bool bHasPendingData = false;
+	bool bIsWriting = false;
+};
+
+namespace
+{
+	void WriteFile(const FString& Filename, const TArray<uint8>& Data)
+	{
+		// Write to a temporary file and then replace the target, so readers never see partially written data.
+		const FString TempFilename = Filename + TEXT(".tmp");
+		if (!FFileHelper::SaveArrayToFile(Data, *TempFilename)
+			|| !IFileManager::Get().Move(*Filename, *TempFilename, true, true))
+		{
+			UE_LOG(LogImGuiIniFile, Warning, TEXT("Couldn't write ImGui session data to '%s'."), *Filename);
+			IFileManager::Get().Delete(*TempFilename, false, false, true);
+		}
+	}
+}
+
+FImGuiIniFile::~FImGuiIniFile()
+{
+	Flush();
+}
+
+bool FImGuiIniFile::IsInMemoryOnly()
+{
+	static const bool bNoSave = FParse::Param(FCommandLine::Get(), TEXT("nosave"));
+	return bNoSave || GIsAutomationTesting;
+}
+
+void FImGuiIniFile::SetFilename(const FString& InFilename)
+{
+	Flush();
+
+	Filename = InFilename;
+	LastHash = 0;
+}
+
+void FImGuiIniFile::Load()
+{
+	// Ini data are UTF-8 text, which ImGui parses directly.
+	TArray<uint8> Data;
+	if (!Filename.IsEmpty() && FFileHelper::LoadFileToArray(Data, *Filename, FILEREAD_Silent) && Data.Num() > 0)
+	{
+		ImGui::LoadIniSettingsFromMemory(reinterpret_cast<const char*>(Data.GetData()), Data.Num());
+		LastHash = FXxHash64::HashBuffer(Data.GetData(), Data.Num()).Hash;
+	}
+}
+
+void FImGuiIniFile::Save()
+{
+	if (Filename.IsEmpty() || IsInMemoryOnly())
+	{
+		return;
+	}
+
+	size_t Size = 0;
+	const char* Data = ImGui::SaveIniSettingsToMemory(&Size);
+
+	// ImGui requests saves after any change that should be reflected in settings, even if serialized data end up the
+	// same (e.g. window moved back and forth), so we compare with the last data that we read or wrote.
+	const uint64 Hash = FXxHash64::HashBuffer(Data, Size).Hash;
+	if (Hash == LastHash)
+	{
+		return;
+	}
+	LastHash = Hash;
+
+	if (!WriteState)
+	{
+		WriteState = MakeShared<FWriteState, ESPMode::ThreadSafe>();
+	}
+
+	FScopeLock ScopeLock(&WriteState->Lock);
+
+	WriteState->PendingData.Reset(Size);
+	WriteState->PendingData.Append(reinterpret_cast<const uint8*>(Data), Size);
+	WriteState->bHasPendingData = true;
+
+	// Task writes pending data until there are none left, so we only need to start one, if it isn't running.
+	if (!WriteState->bIsWriting)
+	{
+		WriteState->bIsWriting = true;
+		WriteTask = Async(EAsyncExecution::ThreadPool, [State = WriteState, Path = Filename]()
+		{
+			TArray<uint8> WriteData;
+			while (true)
+			{
+				{
+					FScopeLock ScopeLock(&State->Lock);
+					if (!State->bHasPendingData)
+					{
+						State->bIsWriting = false;
+						return;
+					}
+
+					WriteData = MoveTemp(State->PendingData);
+					State->bHasPendingData = false;
+				}
+
+				WriteFile(Path, WriteData);
+			}
+		});
+	}
+}
+
+void FImGuiIniFile::Flush()
+{
+	if (WriteTask.IsValid())
+	{
+		WriteTask.Wait();
+		WriteTask.Reset();
+	}
+}
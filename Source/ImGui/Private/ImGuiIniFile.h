@@ -0,0 +1,51 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <Async/Future.h>
+#include <Containers/UnrealString.h>
+#include <Templates/SharedPointer.h>
+
+
+// Session data storage of a single context. Instead of letting ImGui write ini files on the game thread, settings are
+// serialized to memory and written in the background. Writes are coalesced, so only the latest data are written if
+// several saves are requested while a write is in progress, and skipped if data didn't change since the last write.
+class FImGuiIniFile
+{
+public:
+
+	FImGuiIniFile() = default;
+	~FImGuiIniFile();
+
+	FImGuiIniFile(const FImGuiIniFile&) = delete;
+	FImGuiIniFile& operator=(const FImGuiIniFile&) = delete;
+
+	FImGuiIniFile(FImGuiIniFile&&) = delete;
+	FImGuiIniFile& operator=(FImGuiIniFile&&) = delete;
+
+	// Set the file used to store session data or empty string to disable storage. Waits for pending writes to the
+	// previous file.
+	void SetFilename(const FString& InFilename);
+
+	// Load session data from the file to the current ImGui context.
+	void Load();
+
+	// Serialize session data of the current ImGui context and write them in the background, if they changed.
+	void Save();
+
+	// Wait for pending writes to finish.
+	void Flush();
+
+	// Whether session data are only kept in memory. This is the case with -nosave and during automation tests.
+	static bool IsInMemoryOnly();
+
+private:
+
+	struct FWriteState;
+
+	FString Filename;
+	uint64 LastHash = 0;
+
+	TSharedPtr<FWriteState, ESPMode::ThreadSafe> WriteState;
+	TFuture<void> WriteTask;
+};
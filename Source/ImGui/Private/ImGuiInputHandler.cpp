@@ -77,15 +77,11 @@ FReply UImGuiInputHandler::OnKeyDown(const FKeyEvent& KeyEvent)
 
 	InputState->SetKeyDown(KeyEvent, true);
 
-	InputState->KeyDownEvents.Add(KeyEvent.GetKeyCode(), KeyEvent);
-
 	return ToReply(bConsume);
 }
 
 FReply UImGuiInputHandler::OnKeyUp(const FKeyEvent& KeyEvent)
 {
-	InputState->KeyUpEvents.Add(KeyEvent.GetKeyCode(), KeyEvent);
-	
 	if (KeyEvent.GetKey().IsGamepadKey())
 	{
 		bool bConsume = false;
@@ -126,7 +122,7 @@ FReply UImGuiInputHandler::OnMouseButtonDown(const FPointerEvent& MouseEvent)
 	InputState->SetMouseDown(MouseEvent, true);
 	if (ModuleManager)
 	{
-		FImGuiContextProxy* Proxy = ModuleManager->GetContextManager().GetContextProxy(0);
+		FImGuiContextProxy* Proxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
 		if (Proxy)
 		{
 			//GEngine->AddOnScreenDebugMessage(15, 10, Proxy->WantsMouseCapture() ? FColor::Green : FColor::Red, TEXT("Handler Down"));
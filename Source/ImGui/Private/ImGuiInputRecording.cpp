@@ -0,0 +1,363 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiInputRecording.h"
+
+#include "ImGuiContextManager.h"
+#include "Utilities/WorldContextIndex.h"
+#include "VersionCompatibility.h"
+
+#include <Misc/DateTime.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+#include <Serialization/MemoryReader.h>
+#include <Serialization/MemoryWriter.h>
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiInputRecording, Log, All);
+
+namespace
+{
+	// Identifies recording files. Version needs to be increased every time the file layout changes.
+	constexpr uint32 RecordingFileMagic = 0x52494749;
+	constexpr int32 RecordingFileVersion = 1;
+
+	FString GetRecordingsDirectory()
+	{
+#if ENGINE_COMPATIBILITY_LEGACY_SAVED_DIR
+		const FString SavedDir = FPaths::GameSavedDir();
+#else
+		const FString SavedDir = FPaths::ProjectSavedDir();
+#endif
+		return FPaths::Combine(*SavedDir, TEXT("ImGui"), TEXT("InputRecordings"));
+	}
+
+	// Events are stored with only the fields used by their type and with packed integers, so typical events take only
+	// a few bytes.
+	void SerializeEvent(FArchive& Ar, FImGuiInputEvent& Event)
+	{
+		using EType = FImGuiInputEvent::EType;
+
+		uint8 Type = static_cast<uint8>(Event.Type);
+		Ar << Type;
+		Event.Type = static_cast<EType>(Type);
+
+		switch (Event.Type)
+		{
+		case EType::Key:
+		case EType::MouseButton:
+		{
+			uint8 bIsDown = Event.bIsDown;
+			Ar << bIsDown;
+			Event.bIsDown = bIsDown != 0;
+
+			uint32 Code = static_cast<uint32>(Event.Code);
+			Ar.SerializeIntPacked(Code);
+			Event.Code = static_cast<int32>(Code);
+			break;
+		}
+		case EType::Character:
+		{
+			uint32 Code = static_cast<uint32>(Event.Code);
+			Ar.SerializeIntPacked(Code);
+			Event.Code = static_cast<int32>(Code);
+			break;
+		}
+		case EType::MousePosition:
+		case EType::MouseWheel:
+			Ar << Event.Value.X << Event.Value.Y;
+			break;
+		case EType::GamepadAxis:
+		{
+			uint32 Code = static_cast<uint32>(Event.Code);
+			uint32 PositiveCode = static_cast<uint32>(Event.PositiveCode);
+			Ar.SerializeIntPacked(Code);
+			Ar.SerializeIntPacked(PositiveCode);
+			Event.Code = static_cast<int32>(Code);
+			Event.PositiveCode = static_cast<int32>(PositiveCode);
+			Ar << Event.Value.X;
+			break;
+		}
+		default:
+			Ar.SetError();
+			break;
+		}
+	}
+
+	void SerializeFrame(FArchive& Ar, FImGuiInputRecordingFrame& Frame)
+	{
+		Ar << Frame.FrameNumber << Frame.DeltaTime << Frame.NavigationFlags;
+
+		uint32 NumEvents = Frame.Events.Num();
+		Ar.SerializeIntPacked(NumEvents);
+
+		if (Ar.IsLoading())
+		{
+			if (NumEvents > static_cast<uint32>(Ar.TotalSize() - Ar.Tell()))
+			{
+				Ar.SetError();
+				return;
+			}
+			Frame.Events.SetNum(NumEvents);
+		}
+
+		for (FImGuiInputEvent& Event : Frame.Events)
+		{
+			SerializeEvent(Ar, Event);
+		}
+	}
+}
+
+void FImGuiInputRecording::AddFrame(uint32 FrameNumber, float DeltaTime, const FImGuiInputState& InputState)
+{
+	if (Frames.Num() >= MaxFrames)
+	{
+		if (!bTruncated)
+		{
+			bTruncated = true;
+			UE_LOG(LogImGuiInputRecording, Warning, TEXT("Input recording reached the limit of %d frames. Next frames are not recorded."), MaxFrames);
+		}
+		RecordedEvents.Reset();
+		return;
+	}
+
+	FImGuiInputRecordingFrame& Frame = Frames.AddDefaulted_GetRef();
+	Frame.FrameNumber = FrameNumber;
+	Frame.DeltaTime = DeltaTime;
+
+	Frame.NavigationFlags =
+		(InputState.IsKeyboardNavigationEnabled() ? FImGuiInputRecordingFrame::NavigationFlag_Keyboard : 0)
+		| (InputState.IsGamepadNavigationEnabled() ? FImGuiInputRecordingFrame::NavigationFlag_Gamepad : 0)
+		| (InputState.HasGamepad() ? FImGuiInputRecordingFrame::NavigationFlag_HasGamepad : 0);
+
+	// Events passed early, because the journal was full, are recorded together with the rest of the frame's events.
+	Frame.Events = MoveTemp(RecordedEvents);
+	RecordedEvents.Reset();
+}
+
+bool FImGuiInputRecording::Save(const FString& Filename) const
+{
+	TArray<uint8> FileData;
+	FMemoryWriter Writer(FileData);
+
+	uint32 Magic = RecordingFileMagic;
+	int32 Version = RecordingFileVersion;
+	uint32 NumFrames = Frames.Num();
+	Writer << Magic << Version;
+	Writer.SerializeIntPacked(NumFrames);
+
+	for (const FImGuiInputRecordingFrame& Frame : Frames)
+	{
+		SerializeFrame(Writer, const_cast<FImGuiInputRecordingFrame&>(Frame));
+	}
+
+	if (!FFileHelper::SaveArrayToFile(FileData, *Filename))
+	{
+		UE_LOG(LogImGuiInputRecording, Warning, TEXT("Failed to save input recording '%s'."), *Filename);
+		return false;
+	}
+
+	return true;
+}
+
+bool FImGuiInputRecording::Load(const FString& Filename)
+{
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *Filename))
+	{
+		UE_LOG(LogImGuiInputRecording, Warning, TEXT("Failed to load input recording '%s'."), *Filename);
+		return false;
+	}
+
+	FMemoryReader Reader(FileData);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	uint32 NumFrames = 0;
+	Reader << Magic << Version;
+	Reader.SerializeIntPacked(NumFrames);
+
+	if (Magic != RecordingFileMagic || Version != RecordingFileVersion || NumFrames > static_cast<uint32>(FileData.Num()))
+	{
+		UE_LOG(LogImGuiInputRecording, Warning, TEXT("File '%s' is not a valid input recording."), *Filename);
+		return false;
+	}
+
+	TArray<FImGuiInputRecordingFrame> LoadedFrames;
+	LoadedFrames.SetNum(NumFrames);
+	for (FImGuiInputRecordingFrame& Frame : LoadedFrames)
+	{
+		SerializeFrame(Reader, Frame);
+	}
+
+	if (Reader.IsError() || !Reader.AtEnd())
+	{
+		UE_LOG(LogImGuiInputRecording, Warning, TEXT("Input recording '%s' is corrupted."), *Filename);
+		return false;
+	}
+
+	Frames = MoveTemp(LoadedFrames);
+	return true;
+}
+
+FImGuiInputRecorder::FImGuiInputRecorder(FImGuiContextManager& InContextManager)
+	: ContextManager(InContextManager)
+	, StartRecordingCommand(TEXT("ImGui.StartInputRecording"),
+		TEXT("Start recording input of the ImGui context. Optional argument: context index (by default the context of ")
+		TEXT("the current world)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateRaw(this, &FImGuiInputRecorder::StartRecordingImpl))
+	, StopRecordingCommand(TEXT("ImGui.StopInputRecording"),
+		TEXT("Stop recording input of the ImGui context and save it in Saved/ImGui/InputRecordings. Optional argument: ")
+		TEXT("context index (by default the context of the current world)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateRaw(this, &FImGuiInputRecorder::StopRecordingImpl))
+	, ReplayCommand(TEXT("ImGui.ReplayInput"),
+		TEXT("Replay recorded input in the ImGui context and log frame times. Arguments: recording file name, optional ")
+		TEXT("fixed delta time (by default 1/60, 0 uses recorded delta times) and context index (by default the context ")
+		TEXT("of the current world)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateRaw(this, &FImGuiInputRecorder::ReplayImpl))
+{
+}
+
+FImGuiInputRecorder::~FImGuiInputRecorder()
+{
+	TArray<int32> RecordedContexts;
+	Recordings.GetKeys(RecordedContexts);
+	for (int32 ContextIndex : RecordedContexts)
+	{
+		StopRecording(ContextIndex);
+	}
+}
+
+bool FImGuiInputRecorder::StartRecording(int32 ContextIndex)
+{
+	FImGuiContextProxy* ContextProxy = ContextManager.GetContextProxy(ContextIndex);
+	if (!ContextProxy)
+	{
+		return false;
+	}
+
+	if (!Recordings.Contains(ContextIndex))
+	{
+		TUniquePtr<FImGuiInputRecording>& Recording = Recordings.Add(ContextIndex, MakeUnique<FImGuiInputRecording>());
+		ContextProxy->SetInputRecording(Recording.Get());
+	}
+
+	return true;
+}
+
+FString FImGuiInputRecorder::StopRecording(int32 ContextIndex)
+{
+	TUniquePtr<FImGuiInputRecording> Recording;
+	if (!Recordings.RemoveAndCopyValue(ContextIndex, Recording))
+	{
+		return {};
+	}
+
+	FImGuiContextProxy* ContextProxy = ContextManager.GetContextProxy(ContextIndex);
+	if (ContextProxy)
+	{
+		ContextProxy->SetInputRecording(nullptr);
+	}
+
+	const FString ContextName = ContextProxy ? ContextProxy->GetName() : FString::FromInt(ContextIndex);
+	const FString Filename = FPaths::Combine(GetRecordingsDirectory(),
+		FString::Printf(TEXT("%s_%s.imrec"), *ContextName, *FDateTime::Now().ToString()));
+
+	return Recording->Save(Filename) ? Filename : FString{};
+}
+
+bool FImGuiInputRecorder::Replay(int32 ContextIndex, const FString& Filename, float FixedDeltaTime)
+{
+	FImGuiContextProxy* ContextProxy = ContextManager.GetContextProxy(ContextIndex);
+	if (!ContextProxy)
+	{
+		return false;
+	}
+
+	const FString FilePath = FPaths::IsRelative(Filename) && !FPaths::FileExists(Filename)
+		? FPaths::Combine(GetRecordingsDirectory(), Filename) : Filename;
+
+	FImGuiInputRecording Recording;
+	if (!Recording.Load(FilePath))
+	{
+		return false;
+	}
+
+	TArray<double> FrameTimes = ContextProxy->ReplayInput(Recording, FixedDeltaTime);
+	if (FrameTimes.Num() > 0)
+	{
+		FrameTimes.Sort();
+
+		double TotalTime = 0.0;
+		for (double FrameTime : FrameTimes)
+		{
+			TotalTime += FrameTime;
+		}
+
+		UE_LOG(LogImGuiInputRecording, Display,
+			TEXT("Replayed %d frames from '%s' in %.2f ms: Avg = %.3f ms, Median = %.3f ms, P95 = %.3f ms, Max = %.3f ms"),
+			FrameTimes.Num(), *FilePath, TotalTime * 1000.0, TotalTime * 1000.0 / FrameTimes.Num(),
+			FrameTimes[FrameTimes.Num() / 2] * 1000.0, FrameTimes[FrameTimes.Num() * 95 / 100] * 1000.0,
+			FrameTimes.Last() * 1000.0);
+	}
+
+	return true;
+}
+
+namespace
+{
+	int32 GetContextIndexArgument(const TArray<FString>& Args, int32 ArgIndex, UWorld* World)
+	{
+		if (Args.IsValidIndex(ArgIndex))
+		{
+			int32 ContextIndex = Utilities::INVALID_CONTEXT_INDEX;
+			LexFromString(ContextIndex, *Args[ArgIndex]);
+			return ContextIndex;
+		}
+
+		return World ? Utilities::GetWorldContextIndex(*World) : Utilities::INVALID_CONTEXT_INDEX;
+	}
+}
+
+void FImGuiInputRecorder::StartRecordingImpl(const TArray<FString>& Args, UWorld* World)
+{
+	const int32 ContextIndex = GetContextIndexArgument(Args, 0, World);
+	if (!StartRecording(ContextIndex))
+	{
+		UE_LOG(LogImGuiInputRecording, Warning, TEXT("Couldn't find ImGui context %d."), ContextIndex);
+	}
+}
+
+void FImGuiInputRecorder::StopRecordingImpl(const TArray<FString>& Args, UWorld* World)
+{
+	const int32 ContextIndex = GetContextIndexArgument(Args, 0, World);
+	const FString Filename = StopRecording(ContextIndex);
+	if (!Filename.IsEmpty())
+	{
+		UE_LOG(LogImGuiInputRecording, Display, TEXT("Saved input recording '%s'."), *Filename);
+	}
+	else
+	{
+		UE_LOG(LogImGuiInputRecording, Warning, TEXT("ImGui context %d wasn't recorded or recording couldn't be saved."), ContextIndex);
+	}
+}
+
+void FImGuiInputRecorder::ReplayImpl(const TArray<FString>& Args, UWorld* World)
+{
+	if (Args.Num() < 1)
+	{
+		UE_LOG(LogImGuiInputRecording, Warning, TEXT("Missing recording file name."));
+		return;
+	}
+
+	float FixedDeltaTime = 1.f / 60.f;
+	if (Args.Num() > 1)
+	{
+		LexFromString(FixedDeltaTime, *Args[1]);
+	}
+
+	const int32 ContextIndex = GetContextIndexArgument(Args, 2, World);
+	if (!Replay(ContextIndex, Args[0], FixedDeltaTime))
+	{
+		UE_LOG(LogImGuiInputRecording, Warning, TEXT("Couldn't replay '%s' in ImGui context %d."), *Args[0], ContextIndex);
+	}
+}
@@ -0,0 +1,116 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiInputState.h"
+
+#include <HAL/IConsoleManager.h>
+
+
+class FImGuiContextManager;
+
+// Input passed to a context during a single frame.
+struct FImGuiInputRecordingFrame
+{
+	// Navigation state recorded together with events.
+	enum ENavigationFlags : uint8
+	{
+		NavigationFlag_Keyboard = 1 << 0,
+		NavigationFlag_Gamepad = 1 << 1,
+		NavigationFlag_HasGamepad = 1 << 2
+	};
+
+	uint32 FrameNumber = 0;
+	float DeltaTime = 0.f;
+	uint8 NavigationFlags = 0;
+	TArray<FImGuiInputEvent> Events;
+};
+
+// Input recorded for a single context. It can be saved to a compact binary file and replayed later.
+class FImGuiInputRecording
+{
+public:
+
+	// Maximum number of recorded frames (10 minutes at 60 FPS). Frames over this limit are dropped.
+	static constexpr int32 MaxFrames = 36000;
+
+	// Get the array that collects events passed to ImGui IO (see FImGuiInputState::SetRecordedEvents). Collected events
+	// are moved to the next added frame.
+	TArray<FImGuiInputEvent>& GetRecordedEvents() { return RecordedEvents; }
+
+	// Add a frame with the events passed to ImGui IO since the last frame. Events are dropped, if the recording is full.
+	// @param FrameNumber - Engine frame number
+	// @param DeltaTime - Delta time of the frame
+	// @param InputState - Input state, which already passed events of the frame to ImGui IO
+	void AddFrame(uint32 FrameNumber, float DeltaTime, const FImGuiInputState& InputState);
+
+	// Get recorded frames.
+	const TArray<FImGuiInputRecordingFrame>& GetFrames() const { return Frames; }
+
+	// Save the recording to a file.
+	// @param Filename - Path to the file
+	// @returns True, if recording was saved
+	bool Save(const FString& Filename) const;
+
+	// Load a recording from a file, replacing frames in this recording.
+	// @param Filename - Path to the file
+	// @returns True, if recording was loaded
+	bool Load(const FString& Filename);
+
+private:
+
+	TArray<FImGuiInputRecordingFrame> Frames;
+
+	// Events passed to ImGui IO since the last frame.
+	TArray<FImGuiInputEvent> RecordedEvents;
+
+	bool bTruncated = false;
+};
+
+// Records input of contexts to files in Saved/ImGui/InputRecordings and replays it. Replay runs in the live context, with
+// draw events and draw output, but with a fixed time step and without waiting for engine frames, so a recorded session
+// can be used as a repeatable UI benchmark.
+class FImGuiInputRecorder
+{
+public:
+
+	FImGuiInputRecorder(FImGuiContextManager& InContextManager);
+	~FImGuiInputRecorder();
+
+	FImGuiInputRecorder(const FImGuiInputRecorder&) = delete;
+	FImGuiInputRecorder& operator=(const FImGuiInputRecorder&) = delete;
+
+	FImGuiInputRecorder(FImGuiInputRecorder&&) = delete;
+	FImGuiInputRecorder& operator=(FImGuiInputRecorder&&) = delete;
+
+	// Start recording input of a context. Does nothing, if that context is already recorded.
+	// @param ContextIndex - Index of the context
+	// @returns True, if context exists and is recorded
+	bool StartRecording(int32 ContextIndex);
+
+	// Stop recording input of a context and save the recording.
+	// @param ContextIndex - Index of the context
+	// @returns Path to the saved recording or empty string, if context wasn't recorded or recording couldn't be saved
+	FString StopRecording(int32 ContextIndex);
+
+	// Replay recorded input in a context.
+	// @param ContextIndex - Index of the context
+	// @param Filename - Path to the recording (relative paths are resolved in the recordings directory)
+	// @param FixedDeltaTime - Delta time of replayed frames or non-positive value to use recorded delta times
+	// @returns True, if recording was replayed
+	bool Replay(int32 ContextIndex, const FString& Filename, float FixedDeltaTime);
+
+private:
+
+	void StartRecordingImpl(const TArray<FString>& Args, UWorld* World);
+	void StopRecordingImpl(const TArray<FString>& Args, UWorld* World);
+	void ReplayImpl(const TArray<FString>& Args, UWorld* World);
+
+	FImGuiContextManager& ContextManager;
+
+	TMap<int32, TUniquePtr<FImGuiInputRecording>> Recordings;
+
+	FAutoConsoleCommand StartRecordingCommand;
+	FAutoConsoleCommand StopRecordingCommand;
+	FAutoConsoleCommand ReplayCommand;
+};
@@ -14,7 +14,10 @@ FImGuiInputState::FImGuiInputState()
 
 void FImGuiInputState::AddCharacter(TCHAR Char)
 {
-	imguiIO->AddInputCharacter(ImGuiInterops::CastInputChar(Char));
+	FImGuiInputEvent Event;
+	Event.Type = FImGuiInputEvent::EType::Character;
+	Event.Code = ImGuiInterops::CastInputChar(Char);
+	AddEvent(Event);
 }
 
 void FImGuiInputState::SetKeyDown(const FKeyEvent& KeyEvent, bool bIsDown)
@@ -26,7 +29,12 @@ void FImGuiInputState::SetKeyDown(const FKeyEvent& KeyEvent, bool bIsDown)
 void FImGuiInputState::SetKeyDown(const FKey& Key, bool bIsDown)
 {
 	const ImGuiKey imKey = ImGuiInterops::GetImGuiKey(Key);
-	imguiIO->AddKeyEvent(imKey, bIsDown);
+
+	FImGuiInputEvent Event;
+	Event.Type = FImGuiInputEvent::EType::Key;
+	Event.bIsDown = bIsDown;
+	Event.Code = imKey;
+	AddEvent(Event);
 
 	bIsLeftControlDown = imKey == ImGuiKey_LeftCtrl && bIsDown;
 	bIsRightControlDown = imKey == ImGuiKey_RightCtrl && bIsDown;
@@ -47,25 +55,35 @@ void FImGuiInputState::SetKeyDown(const FKey& Key, bool bIsDown)
 
 void FImGuiInputState::SetMouseDown(const FPointerEvent& MouseEvent, bool bIsDown)
 {
-	const uint32 mouseIndex = ImGuiInterops::GetMouseIndex(MouseEvent);
-	imguiIO->AddMouseButtonEvent(mouseIndex, bIsDown);
+	SetMouseDown(MouseEvent.GetEffectingButton(), bIsDown);
 }
 
 void FImGuiInputState::SetMouseDown(const FKey& MouseButton, bool bIsDown)
 {
-	const uint32 mouseIndex = ImGuiInterops::GetMouseIndex(MouseButton);
-	imguiIO->AddMouseButtonEvent(mouseIndex, bIsDown);	
+	FImGuiInputEvent Event;
+	Event.Type = FImGuiInputEvent::EType::MouseButton;
+	Event.bIsDown = bIsDown;
+	Event.Code = ImGuiInterops::GetMouseIndex(MouseButton);
+	AddEvent(Event);
 }
 
 void FImGuiInputState::AddMouseWheelDelta(float DeltaValue)
 {
-	imguiIO->AddMouseWheelEvent(0, DeltaValue);
+	FImGuiInputEvent Event;
+	Event.Type = FImGuiInputEvent::EType::MouseWheel;
+	Event.Value.Y = DeltaValue;
+	AddEvent(Event);
+
 	MouseWheelDelta += DeltaValue;
 }
 
 void FImGuiInputState::SetMousePosition(const FVector2D& Position)
 {
-	imguiIO->AddMousePosEvent(Position.X, Position.Y);
+	FImGuiInputEvent Event;
+	Event.Type = FImGuiInputEvent::EType::MousePosition;
+	Event.Value = FVector2f(Position);
+	AddEvent(Event);
+
 	MousePosition = Position;
 }
 
@@ -77,13 +95,22 @@ void FImGuiInputState::SetMousePointer(bool bInHasMousePointer)
 
 void FImGuiInputState::SetTouchDown(bool bIsDown)
 {
-	imguiIO->AddMouseButtonEvent(0, bIsDown);
+	// Touch is simulated with the left mouse button.
+	FImGuiInputEvent Event;
+	Event.Type = FImGuiInputEvent::EType::MouseButton;
+	Event.bIsDown = bIsDown;
+	Event.Code = 0;
+	AddEvent(Event);
+
 	bTouchDown = bIsDown;	
 }
 
 void FImGuiInputState::SetTouchPosition(const FVector2D& Position)
 {
-	imguiIO->AddMousePosEvent(Position.X, Position.Y);
+	FImGuiInputEvent Event;
+	Event.Type = FImGuiInputEvent::EType::MousePosition;
+	Event.Value = FVector2f(Position);
+	AddEvent(Event);
 }
 
 void FImGuiInputState::SetGamepadNavigationAxis(const FAnalogInputEvent& AnalogInputEvent, float Value)
@@ -94,22 +121,13 @@ void FImGuiInputState::SetGamepadNavigationAxis(const FAnalogInputEvent& AnalogI
 	}
 	
 	const auto [Negative, Positive] = ImGuiInterops::GetImGuiNavigationAxis(AnalogInputEvent.GetKey());
-	
-	static constexpr float AxisInputThreshold = 0.166f;
-
-	// Filter out small values to avoid false positives (helpful in case of worn controllers).
-	const float AxisValue = FMath::Max(0.f, Value - AxisInputThreshold);
 
-	if (Value < 0.f)
-	{
-		imguiIO->AddKeyAnalogEvent(Negative, AxisValue > 0.10f, AxisValue);
-		imguiIO->AddKeyAnalogEvent(Positive, false, 0.f);		
-	}
-	else
-	{
-		imguiIO->AddKeyAnalogEvent(Positive, AxisValue > 0.10f, AxisValue);
-		imguiIO->AddKeyAnalogEvent(Negative, false, 0.f);		
-	}
+	FImGuiInputEvent Event;
+	Event.Type = FImGuiInputEvent::EType::GamepadAxis;
+	Event.Code = Negative;
+	Event.PositiveCode = Positive;
+	Event.Value.X = Value;
+	AddEvent(Event);
 }
 
 void FImGuiInputState::SetKeyboardNavigationEnabled(bool bEnabled)
@@ -130,6 +148,110 @@ void FImGuiInputState::SetGamepad(bool bInHasGamepad)
 	bHasGamepad = bInHasGamepad;	
 }
 
+void FImGuiInputState::FlushEvents()
+{
+	while (NumJournalEvents > 0)
+	{
+		ApplyEvent(JournalEvents[FirstJournalEvent]);
+		FirstJournalEvent = (FirstJournalEvent + 1) % MaxJournalEvents;
+		NumJournalEvents--;
+	}
+	FirstJournalEvent = 0;
+}
+
+void FImGuiInputState::AddEvent(const FImGuiInputEvent& Event)
+{
+	using EType = FImGuiInputEvent::EType;
+
+	// High-frequency events are merged with the previous event of the same kind, as long as nothing happened in
+	// between. Only the final position and the sum of wheel deltas matter for ImGui.
+	if (NumJournalEvents > 0)
+	{
+		FImGuiInputEvent& LastEvent = JournalEvents[(FirstJournalEvent + NumJournalEvents - 1) % MaxJournalEvents];
+		if (LastEvent.Type == Event.Type)
+		{
+			if (Event.Type == EType::MousePosition || (Event.Type == EType::GamepadAxis && LastEvent.Code == Event.Code))
+			{
+				LastEvent.Value = Event.Value;
+				return;
+			}
+			else if (Event.Type == EType::MouseWheel)
+			{
+				LastEvent.Value += Event.Value;
+				return;
+			}
+		}
+	}
+
+	// If the journal is full, pass the oldest event to ImGui IO, so the order of transitions is preserved.
+	if (NumJournalEvents == MaxJournalEvents)
+	{
+		ApplyEvent(JournalEvents[FirstJournalEvent]);
+		FirstJournalEvent = (FirstJournalEvent + 1) % MaxJournalEvents;
+		NumJournalEvents--;
+	}
+
+	JournalEvents[(FirstJournalEvent + NumJournalEvents) % MaxJournalEvents] = Event;
+	NumJournalEvents++;
+}
+
+void FImGuiInputState::ApplyEvents(const TArray<FImGuiInputEvent>& Events)
+{
+	for (const FImGuiInputEvent& Event : Events)
+	{
+		ApplyEvent(Event);
+	}
+}
+
+void FImGuiInputState::ApplyEvent(const FImGuiInputEvent& Event)
+{
+	if (RecordedEvents)
+	{
+		RecordedEvents->Add(Event);
+	}
+
+	switch (Event.Type)
+	{
+	case FImGuiInputEvent::EType::Key:
+		imguiIO->AddKeyEvent(static_cast<ImGuiKey>(Event.Code), Event.bIsDown);
+		break;
+	case FImGuiInputEvent::EType::MouseButton:
+		imguiIO->AddMouseButtonEvent(Event.Code, Event.bIsDown);
+		break;
+	case FImGuiInputEvent::EType::MousePosition:
+		imguiIO->AddMousePosEvent(Event.Value.X, Event.Value.Y);
+		break;
+	case FImGuiInputEvent::EType::MouseWheel:
+		imguiIO->AddMouseWheelEvent(Event.Value.X, Event.Value.Y);
+		break;
+	case FImGuiInputEvent::EType::Character:
+		imguiIO->AddInputCharacter(Event.Code);
+		break;
+	case FImGuiInputEvent::EType::GamepadAxis:
+	{
+		const ImGuiKey Negative = static_cast<ImGuiKey>(Event.Code);
+		const ImGuiKey Positive = static_cast<ImGuiKey>(Event.PositiveCode);
+
+		static constexpr float AxisInputThreshold = 0.166f;
+
+		// Filter out small values to avoid false positives (helpful in case of worn controllers).
+		const float AxisValue = FMath::Max(0.f, Event.Value.X - AxisInputThreshold);
+
+		if (Event.Value.X < 0.f)
+		{
+			imguiIO->AddKeyAnalogEvent(Negative, AxisValue > 0.10f, AxisValue);
+			imguiIO->AddKeyAnalogEvent(Positive, false, 0.f);
+		}
+		else
+		{
+			imguiIO->AddKeyAnalogEvent(Positive, AxisValue > 0.10f, AxisValue);
+			imguiIO->AddKeyAnalogEvent(Negative, false, 0.f);
+		}
+		break;
+	}
+	}
+}
+
 void FImGuiInputState::ClearUpdateState()
 {
 	bTouchProcessed = bTouchDown;
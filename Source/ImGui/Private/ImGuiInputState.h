@@ -8,10 +8,41 @@
 #include <Containers/Array.h>
 
 
+// Input event collected by the input state and passed to ImGui IO once per frame.
+struct FImGuiInputEvent
+{
+	enum class EType : uint8
+	{
+		Key,
+		MouseButton,
+		MousePosition,
+		MouseWheel,
+		Character,
+		GamepadAxis
+	};
+
+	EType Type = EType::Key;
+	bool bIsDown = false;
+
+	// ImGui key, mouse button index, character or ImGui key for the negative direction of gamepad axis.
+	int32 Code = 0;
+
+	// ImGui key for the positive direction of gamepad axis.
+	int32 PositiveCode = 0;
+
+	// Mouse position, mouse wheel delta or gamepad axis value (in X).
+	FVector2f Value = FVector2f::ZeroVector;
+};
+
 // Collects and stores input state and updates for ImGui IO.
 class FImGuiInputState
 {
 public:
+
+	// Capacity of the events journal. If more events are collected during a frame, the oldest ones are passed to ImGui
+	// IO early, so no transitions are lost.
+	static constexpr int32 MaxJournalEvents = 256;
+
 	// Create empty state with whole range instance with the whole update state marked as dirty.
 	FImGuiInputState();
 
@@ -146,19 +177,49 @@ public:
 	}
 
 	FORCEINLINE void SetCurrentFrameIO(ImGuiIO* io) { imguiIO = io; }
+
+	// Pass events collected since the last frame to ImGui IO and clear the events journal.
+	void FlushEvents();
+
+	// Get the number of events waiting in the journal.
+	int32 GetNumPendingEvents() const { return NumJournalEvents; }
+
+	// Add an event to the journal. Consecutive mouse moves, mouse wheel scrolls and moves of the same gamepad axis are
+	// merged, while other events keep their order.
+	// @param Event - Event to add
+	void AddEvent(const FImGuiInputEvent& Event);
+
+	// Discard events waiting in the journal.
+	void ClearEvents() { FirstJournalEvent = NumJournalEvents = 0; }
+
+	// Pass events directly to ImGui IO, bypassing the journal. Used to replay events in the same order in which they
+	// were passed to ImGui IO when they were recorded.
+	// @param Events - Events to pass
+	void ApplyEvents(const TArray<FImGuiInputEvent>& Events);
+
+	// Set the array that receives every event passed to ImGui IO, including events passed early because the journal was
+	// full, or null to stop recording events.
+	// @param Events - Array that receives events (it is not cleared)
+	void SetRecordedEvents(TArray<FImGuiInputEvent>* Events) { RecordedEvents = Events; }
 	
 	// Clear part of the state that is meant to be updated in every frame like: accumulators, buffers, navigation data
 	// and information about dirty parts of keys or mouse buttons arrays.
 	void ClearUpdateState();
 
-	TMap<uint32, FKeyEvent> KeyDownEvents;
-	TMap<uint32, FKeyEvent> KeyUpEvents;
-
 private:
 	ImGuiIO* imguiIO{nullptr};
 	void ClearMouseAnalogue();
 	void ClearModifierKeys();
 
+	void ApplyEvent(const FImGuiInputEvent& Event);
+
+	// Events collected since the last frame, stored in a ring buffer.
+	FImGuiInputEvent JournalEvents[MaxJournalEvents];
+	int32 FirstJournalEvent = 0;
+	int32 NumJournalEvents = 0;
+
+	TArray<FImGuiInputEvent>* RecordedEvents = nullptr;
+
 	FVector2D MousePosition = FVector2D::ZeroVector;
 	FVector2D TouchPosition = FVector2D::ZeroVector;
 	float MouseWheelDelta = 0.f;
@@ -12,153 +12,213 @@ namespace ImGuiInterops
 	// Input Mapping
 	//====================================================================================================
 
-	static TMap<FKey, int32> UnrealToImGuiMouseMap;
-	static TMap<FKey, ImGuiKey> UnrealToImGuiKeyMap;
-	static TMap<FKey, ImGuiGamepadKeyRange> UnrealToImGuiAnalogAxis;
-
-	void SetUnrealKeyMap()
+	namespace
 	{
-		UnrealToImGuiKeyMap.Add(EKeys::LeftControl,		ImGuiKey_LeftCtrl);
-		UnrealToImGuiKeyMap.Add(EKeys::RightControl,	ImGuiKey_RightCtrl);
-		UnrealToImGuiKeyMap.Add(EKeys::LeftShift,		ImGuiKey_LeftShift);
-		UnrealToImGuiKeyMap.Add(EKeys::RightShift,		ImGuiKey_RightShift);
-		UnrealToImGuiKeyMap.Add(EKeys::LeftAlt,			ImGuiKey_LeftAlt);
-		UnrealToImGuiKeyMap.Add(EKeys::RightAlt,		ImGuiKey_RightAlt);
-		UnrealToImGuiKeyMap.Add(EKeys::LeftCommand,		ImGuiKey_LeftSuper);
-		UnrealToImGuiKeyMap.Add(EKeys::RightCommand,	ImGuiKey_RightSuper);	
-		
-		UnrealToImGuiKeyMap.Add(EKeys::Tab, ImGuiKey_Tab);
-		
-		UnrealToImGuiKeyMap.Add(EKeys::Left,  ImGuiKey_LeftArrow);
-		UnrealToImGuiKeyMap.Add(EKeys::Right, ImGuiKey_RightArrow);
-		UnrealToImGuiKeyMap.Add(EKeys::Up,    ImGuiKey_UpArrow);
-		UnrealToImGuiKeyMap.Add(EKeys::Down,  ImGuiKey_DownArrow);
-		
-		UnrealToImGuiKeyMap.Add(EKeys::PageUp,   ImGuiKey_PageUp);
-		UnrealToImGuiKeyMap.Add(EKeys::PageDown, ImGuiKey_PageDown);
-		UnrealToImGuiKeyMap.Add(EKeys::Home,     ImGuiKey_Home);
-		UnrealToImGuiKeyMap.Add(EKeys::End,      ImGuiKey_End);
-		UnrealToImGuiKeyMap.Add(EKeys::Insert,   ImGuiKey_Insert);
-		UnrealToImGuiKeyMap.Add(EKeys::Delete,   ImGuiKey_Delete);
-
-		UnrealToImGuiKeyMap.Add(EKeys::NumLock,    ImGuiKey_NumLock);
-		UnrealToImGuiKeyMap.Add(EKeys::ScrollLock, ImGuiKey_ScrollLock);
-		UnrealToImGuiKeyMap.Add(EKeys::Pause,      ImGuiKey_Pause);
-		
-		UnrealToImGuiKeyMap.Add(EKeys::BackSpace, ImGuiKey_Backspace);
-		UnrealToImGuiKeyMap.Add(EKeys::SpaceBar,  ImGuiKey_Space);
-		UnrealToImGuiKeyMap.Add(EKeys::Enter,     ImGuiKey_Enter);
-		UnrealToImGuiKeyMap.Add(EKeys::Escape,     ImGuiKey_Escape);
-		
-		UnrealToImGuiKeyMap.Add(EKeys::A, ImGuiKey_A);
-		UnrealToImGuiKeyMap.Add(EKeys::B, ImGuiKey_B);
-		UnrealToImGuiKeyMap.Add(EKeys::C, ImGuiKey_C);
-		UnrealToImGuiKeyMap.Add(EKeys::D, ImGuiKey_D);
-		UnrealToImGuiKeyMap.Add(EKeys::E, ImGuiKey_E);
-		UnrealToImGuiKeyMap.Add(EKeys::F, ImGuiKey_F);
-		UnrealToImGuiKeyMap.Add(EKeys::G, ImGuiKey_G);
-		UnrealToImGuiKeyMap.Add(EKeys::H, ImGuiKey_H);
-		UnrealToImGuiKeyMap.Add(EKeys::I, ImGuiKey_I);
-		UnrealToImGuiKeyMap.Add(EKeys::J, ImGuiKey_J);
-		UnrealToImGuiKeyMap.Add(EKeys::K, ImGuiKey_K);
-		UnrealToImGuiKeyMap.Add(EKeys::L, ImGuiKey_L);
-		UnrealToImGuiKeyMap.Add(EKeys::M, ImGuiKey_M);
-		UnrealToImGuiKeyMap.Add(EKeys::N, ImGuiKey_N);
-		UnrealToImGuiKeyMap.Add(EKeys::O, ImGuiKey_O);
-		UnrealToImGuiKeyMap.Add(EKeys::P, ImGuiKey_P);
-		UnrealToImGuiKeyMap.Add(EKeys::Q, ImGuiKey_Q);
-		UnrealToImGuiKeyMap.Add(EKeys::R, ImGuiKey_R);
-		UnrealToImGuiKeyMap.Add(EKeys::S, ImGuiKey_S);
-		UnrealToImGuiKeyMap.Add(EKeys::T, ImGuiKey_T);
-		UnrealToImGuiKeyMap.Add(EKeys::U, ImGuiKey_U);
-		UnrealToImGuiKeyMap.Add(EKeys::V, ImGuiKey_V);
-		UnrealToImGuiKeyMap.Add(EKeys::W, ImGuiKey_W);
-		UnrealToImGuiKeyMap.Add(EKeys::X, ImGuiKey_X);
-		UnrealToImGuiKeyMap.Add(EKeys::Y, ImGuiKey_Y);
-		UnrealToImGuiKeyMap.Add(EKeys::Z, ImGuiKey_Z);
-		
-		UnrealToImGuiKeyMap.Add(EKeys::F1,  ImGuiKey_F1);
-		UnrealToImGuiKeyMap.Add(EKeys::F2,  ImGuiKey_F2);
-		UnrealToImGuiKeyMap.Add(EKeys::F3,  ImGuiKey_F3);
-		UnrealToImGuiKeyMap.Add(EKeys::F4,  ImGuiKey_F4);
-		UnrealToImGuiKeyMap.Add(EKeys::F5,  ImGuiKey_F5);
-		UnrealToImGuiKeyMap.Add(EKeys::F6,  ImGuiKey_F6);
-		UnrealToImGuiKeyMap.Add(EKeys::F7,  ImGuiKey_F7);
-		UnrealToImGuiKeyMap.Add(EKeys::F8,  ImGuiKey_F8);
-		UnrealToImGuiKeyMap.Add(EKeys::F9,  ImGuiKey_F9);
-		UnrealToImGuiKeyMap.Add(EKeys::F10, ImGuiKey_F10);
-		UnrealToImGuiKeyMap.Add(EKeys::F11, ImGuiKey_F11);
-		UnrealToImGuiKeyMap.Add(EKeys::F12, ImGuiKey_F12);
-		
-		UnrealToImGuiKeyMap.Add(EKeys::Zero,  ImGuiKey_0);
-		UnrealToImGuiKeyMap.Add(EKeys::One,   ImGuiKey_1);
-		UnrealToImGuiKeyMap.Add(EKeys::Two,   ImGuiKey_2);
-		UnrealToImGuiKeyMap.Add(EKeys::Three, ImGuiKey_3);
-		UnrealToImGuiKeyMap.Add(EKeys::Four,  ImGuiKey_4);
-		UnrealToImGuiKeyMap.Add(EKeys::Five,  ImGuiKey_5);
-		UnrealToImGuiKeyMap.Add(EKeys::Six,   ImGuiKey_6);
-		UnrealToImGuiKeyMap.Add(EKeys::Seven, ImGuiKey_7);
-		UnrealToImGuiKeyMap.Add(EKeys::Eight, ImGuiKey_8);
-		UnrealToImGuiKeyMap.Add(EKeys::Nine,  ImGuiKey_9);
-		
-		UnrealToImGuiKeyMap.Add(EKeys::Equals,       ImGuiKey_Equal);
-		UnrealToImGuiKeyMap.Add(EKeys::Comma,        ImGuiKey_Comma);
-		UnrealToImGuiKeyMap.Add(EKeys::Period,       ImGuiKey_Period);
-		UnrealToImGuiKeyMap.Add(EKeys::Slash,        ImGuiKey_Slash);
-		UnrealToImGuiKeyMap.Add(EKeys::LeftBracket,  ImGuiKey_LeftBracket);
-		UnrealToImGuiKeyMap.Add(EKeys::RightBracket, ImGuiKey_RightBracket);
-		UnrealToImGuiKeyMap.Add(EKeys::Apostrophe,   ImGuiKey_Apostrophe);
-		UnrealToImGuiKeyMap.Add(EKeys::Semicolon,    ImGuiKey_Semicolon);
-
-		UnrealToImGuiKeyMap.Add(EKeys::NumPadZero,  ImGuiKey_Keypad0);
-		UnrealToImGuiKeyMap.Add(EKeys::NumPadOne,   ImGuiKey_Keypad1);
-		UnrealToImGuiKeyMap.Add(EKeys::NumPadTwo,   ImGuiKey_Keypad2);
-		UnrealToImGuiKeyMap.Add(EKeys::NumPadThree, ImGuiKey_Keypad3);
-		UnrealToImGuiKeyMap.Add(EKeys::NumPadFour,  ImGuiKey_Keypad4);
-		UnrealToImGuiKeyMap.Add(EKeys::NumPadFive,  ImGuiKey_Keypad5);
-		UnrealToImGuiKeyMap.Add(EKeys::NumPadSix,   ImGuiKey_Keypad6);
-		UnrealToImGuiKeyMap.Add(EKeys::NumPadSeven, ImGuiKey_Keypad7);
-		UnrealToImGuiKeyMap.Add(EKeys::NumPadEight, ImGuiKey_Keypad8);
-		UnrealToImGuiKeyMap.Add(EKeys::NumPadNine,  ImGuiKey_Keypad9);
-
-		UnrealToImGuiKeyMap.Add(EKeys::Multiply, ImGuiKey_KeypadMultiply);
-		UnrealToImGuiKeyMap.Add(EKeys::Add,      ImGuiKey_KeypadAdd);
-		UnrealToImGuiKeyMap.Add(EKeys::Subtract, ImGuiKey_KeypadSubtract);
-		UnrealToImGuiKeyMap.Add(EKeys::Decimal,  ImGuiKey_KeypadDecimal);
-		UnrealToImGuiKeyMap.Add(EKeys::Divide,   ImGuiKey_KeypadDivide);
-
-		UnrealToImGuiKeyMap.Add(EKeys::Gamepad_FaceButton_Bottom, ImGuiKey_GamepadFaceDown);
-		UnrealToImGuiKeyMap.Add(EKeys::Gamepad_FaceButton_Right, ImGuiKey_GamepadFaceRight);
-		UnrealToImGuiKeyMap.Add(EKeys::Gamepad_FaceButton_Top, ImGuiKey_GamepadFaceUp);
-		UnrealToImGuiKeyMap.Add(EKeys::Gamepad_FaceButton_Left, ImGuiKey_GamepadFaceLeft);
-		UnrealToImGuiKeyMap.Add(EKeys::Gamepad_DPad_Left, ImGuiKey_GamepadDpadLeft);
-		UnrealToImGuiKeyMap.Add(EKeys::Gamepad_DPad_Right, ImGuiKey_GamepadDpadRight);
-		UnrealToImGuiKeyMap.Add(EKeys::Gamepad_DPad_Up, ImGuiKey_GamepadDpadUp);
-		UnrealToImGuiKeyMap.Add(EKeys::Gamepad_DPad_Down, ImGuiKey_GamepadDpadDown);
-		UnrealToImGuiKeyMap.Add(EKeys::Gamepad_LeftShoulder, ImGuiKey_GamepadL1);
-		UnrealToImGuiKeyMap.Add(EKeys::Gamepad_RightShoulder, ImGuiKey_GamepadR1);		
-		
-		UnrealToImGuiMouseMap.Add(EKeys::LeftMouseButton, 0);
-		UnrealToImGuiMouseMap.Add(EKeys::RightMouseButton, 1);
-		UnrealToImGuiMouseMap.Add(EKeys::MiddleMouseButton, 2);
-		UnrealToImGuiMouseMap.Add(EKeys::ThumbMouseButton, 3);
-		UnrealToImGuiMouseMap.Add(EKeys::ThumbMouseButton2, 4);
-		
-		
-		UnrealToImGuiAnalogAxis.Add(EKeys::Gamepad_LeftX,  {ImGuiKey_GamepadLStickLeft, ImGuiKey_GamepadLStickRight});
-		UnrealToImGuiAnalogAxis.Add(EKeys::Gamepad_LeftY,  {ImGuiKey_GamepadLStickDown, ImGuiKey_GamepadLStickUp});
-		UnrealToImGuiAnalogAxis.Add(EKeys::Gamepad_RightX, {ImGuiKey_GamepadRStickLeft, ImGuiKey_GamepadRStickRight});
-		UnrealToImGuiAnalogAxis.Add(EKeys::Gamepad_RightY, {ImGuiKey_GamepadRStickDown, ImGuiKey_GamepadRStickUp});
+		// Translations of a single Unreal key.
+		struct FKeyMapping
+		{
+			FName KeyName;
+			ImGuiKey Key = ImGuiKey_None;
+			int32 MouseIndex = -1;
+			ImGuiGamepadKeyRange Axis = {};
+		};
+
+		// Table with translations of all keys, built once on the first use. Unlike TMap<FKey, ...>, it only hashes key
+		// names and it is sparse enough (open addressing with a low load factor), so most lookups read a single slot.
+		class FKeyMappingTable
+		{
+		public:
+
+			static const FKeyMappingTable& Get()
+			{
+				static const FKeyMappingTable Instance;
+				return Instance;
+			}
+
+			// Find translations for a key. Keys without translations get an empty mapping.
+			FORCEINLINE const FKeyMapping& Find(const FKey& Key) const
+			{
+				const FName KeyName = Key.GetFName();
+				for (uint32 Slot = GetSlot(KeyName);; Slot = (Slot + 1) & SlotMask)
+				{
+					const FKeyMapping& Mapping = Mappings[Slot];
+					if (Mapping.KeyName == KeyName || Mapping.KeyName.IsNone())
+					{
+						return Mapping;
+					}
+				}
+			}
+
+		private:
+
+			FKeyMappingTable()
+			{
+				AddKey(EKeys::LeftControl,		ImGuiKey_LeftCtrl);
+				AddKey(EKeys::RightControl,	ImGuiKey_RightCtrl);
+				AddKey(EKeys::LeftShift,		ImGuiKey_LeftShift);
+				AddKey(EKeys::RightShift,		ImGuiKey_RightShift);
+				AddKey(EKeys::LeftAlt,			ImGuiKey_LeftAlt);
+				AddKey(EKeys::RightAlt,		ImGuiKey_RightAlt);
+				AddKey(EKeys::LeftCommand,		ImGuiKey_LeftSuper);
+				AddKey(EKeys::RightCommand,	ImGuiKey_RightSuper);
+
+				AddKey(EKeys::Tab, ImGuiKey_Tab);
+
+				AddKey(EKeys::Left,  ImGuiKey_LeftArrow);
+				AddKey(EKeys::Right, ImGuiKey_RightArrow);
+				AddKey(EKeys::Up,    ImGuiKey_UpArrow);
+				AddKey(EKeys::Down,  ImGuiKey_DownArrow);
+
+				AddKey(EKeys::PageUp,   ImGuiKey_PageUp);
+				AddKey(EKeys::PageDown, ImGuiKey_PageDown);
+				AddKey(EKeys::Home,     ImGuiKey_Home);
+				AddKey(EKeys::End,      ImGuiKey_End);
+				AddKey(EKeys::Insert,   ImGuiKey_Insert);
+				AddKey(EKeys::Delete,   ImGuiKey_Delete);
+
+				AddKey(EKeys::NumLock,    ImGuiKey_NumLock);
+				AddKey(EKeys::ScrollLock, ImGuiKey_ScrollLock);
+				AddKey(EKeys::Pause,      ImGuiKey_Pause);
+
+				AddKey(EKeys::BackSpace, ImGuiKey_Backspace);
+				AddKey(EKeys::SpaceBar,  ImGuiKey_Space);
+				AddKey(EKeys::Enter,     ImGuiKey_Enter);
+				AddKey(EKeys::Escape,     ImGuiKey_Escape);
+
+				AddKey(EKeys::A, ImGuiKey_A);
+				AddKey(EKeys::B, ImGuiKey_B);
+				AddKey(EKeys::C, ImGuiKey_C);
+				AddKey(EKeys::D, ImGuiKey_D);
+				AddKey(EKeys::E, ImGuiKey_E);
+				AddKey(EKeys::F, ImGuiKey_F);
+				AddKey(EKeys::G, ImGuiKey_G);
+				AddKey(EKeys::H, ImGuiKey_H);
+				AddKey(EKeys::I, ImGuiKey_I);
+				AddKey(EKeys::J, ImGuiKey_J);
+				AddKey(EKeys::K, ImGuiKey_K);
+				AddKey(EKeys::L, ImGuiKey_L);
+				AddKey(EKeys::M, ImGuiKey_M);
+				AddKey(EKeys::N, ImGuiKey_N);
+				AddKey(EKeys::O, ImGuiKey_O);
+				AddKey(EKeys::P, ImGuiKey_P);
+				AddKey(EKeys::Q, ImGuiKey_Q);
+				AddKey(EKeys::R, ImGuiKey_R);
+				AddKey(EKeys::S, ImGuiKey_S);
+				AddKey(EKeys::T, ImGuiKey_T);
+				AddKey(EKeys::U, ImGuiKey_U);
+				AddKey(EKeys::V, ImGuiKey_V);
+				AddKey(EKeys::W, ImGuiKey_W);
+				AddKey(EKeys::X, ImGuiKey_X);
+				AddKey(EKeys::Y, ImGuiKey_Y);
+				AddKey(EKeys::Z, ImGuiKey_Z);
+
+				AddKey(EKeys::F1,  ImGuiKey_F1);
+				AddKey(EKeys::F2,  ImGuiKey_F2);
+				AddKey(EKeys::F3,  ImGuiKey_F3);
+				AddKey(EKeys::F4,  ImGuiKey_F4);
+				AddKey(EKeys::F5,  ImGuiKey_F5);
+				AddKey(EKeys::F6,  ImGuiKey_F6);
+				AddKey(EKeys::F7,  ImGuiKey_F7);
+				AddKey(EKeys::F8,  ImGuiKey_F8);
+				AddKey(EKeys::F9,  ImGuiKey_F9);
+				AddKey(EKeys::F10, ImGuiKey_F10);
+				AddKey(EKeys::F11, ImGuiKey_F11);
+				AddKey(EKeys::F12, ImGuiKey_F12);
+
+				AddKey(EKeys::Zero,  ImGuiKey_0);
+				AddKey(EKeys::One,   ImGuiKey_1);
+				AddKey(EKeys::Two,   ImGuiKey_2);
+				AddKey(EKeys::Three, ImGuiKey_3);
+				AddKey(EKeys::Four,  ImGuiKey_4);
+				AddKey(EKeys::Five,  ImGuiKey_5);
+				AddKey(EKeys::Six,   ImGuiKey_6);
+				AddKey(EKeys::Seven, ImGuiKey_7);
+				AddKey(EKeys::Eight, ImGuiKey_8);
+				AddKey(EKeys::Nine,  ImGuiKey_9);
+
+				AddKey(EKeys::Equals,       ImGuiKey_Equal);
+				AddKey(EKeys::Comma,        ImGuiKey_Comma);
+				AddKey(EKeys::Period,       ImGuiKey_Period);
+				AddKey(EKeys::Slash,        ImGuiKey_Slash);
+				AddKey(EKeys::LeftBracket,  ImGuiKey_LeftBracket);
+				AddKey(EKeys::RightBracket, ImGuiKey_RightBracket);
+				AddKey(EKeys::Apostrophe,   ImGuiKey_Apostrophe);
+				AddKey(EKeys::Semicolon,    ImGuiKey_Semicolon);
+
+				AddKey(EKeys::NumPadZero,  ImGuiKey_Keypad0);
+				AddKey(EKeys::NumPadOne,   ImGuiKey_Keypad1);
+				AddKey(EKeys::NumPadTwo,   ImGuiKey_Keypad2);
+				AddKey(EKeys::NumPadThree, ImGuiKey_Keypad3);
+				AddKey(EKeys::NumPadFour,  ImGuiKey_Keypad4);
+				AddKey(EKeys::NumPadFive,  ImGuiKey_Keypad5);
+				AddKey(EKeys::NumPadSix,   ImGuiKey_Keypad6);
+				AddKey(EKeys::NumPadSeven, ImGuiKey_Keypad7);
+				AddKey(EKeys::NumPadEight, ImGuiKey_Keypad8);
+				AddKey(EKeys::NumPadNine,  ImGuiKey_Keypad9);
+
+				AddKey(EKeys::Multiply, ImGuiKey_KeypadMultiply);
+				AddKey(EKeys::Add,      ImGuiKey_KeypadAdd);
+				AddKey(EKeys::Subtract, ImGuiKey_KeypadSubtract);
+				AddKey(EKeys::Decimal,  ImGuiKey_KeypadDecimal);
+				AddKey(EKeys::Divide,   ImGuiKey_KeypadDivide);
+
+				AddKey(EKeys::Gamepad_FaceButton_Bottom, ImGuiKey_GamepadFaceDown);
+				AddKey(EKeys::Gamepad_FaceButton_Right, ImGuiKey_GamepadFaceRight);
+				AddKey(EKeys::Gamepad_FaceButton_Top, ImGuiKey_GamepadFaceUp);
+				AddKey(EKeys::Gamepad_FaceButton_Left, ImGuiKey_GamepadFaceLeft);
+				AddKey(EKeys::Gamepad_DPad_Left, ImGuiKey_GamepadDpadLeft);
+				AddKey(EKeys::Gamepad_DPad_Right, ImGuiKey_GamepadDpadRight);
+				AddKey(EKeys::Gamepad_DPad_Up, ImGuiKey_GamepadDpadUp);
+				AddKey(EKeys::Gamepad_DPad_Down, ImGuiKey_GamepadDpadDown);
+				AddKey(EKeys::Gamepad_LeftShoulder, ImGuiKey_GamepadL1);
+				AddKey(EKeys::Gamepad_RightShoulder, ImGuiKey_GamepadR1);
+
+				AddMouseButton(EKeys::LeftMouseButton, 0);
+				AddMouseButton(EKeys::RightMouseButton, 1);
+				AddMouseButton(EKeys::MiddleMouseButton, 2);
+				AddMouseButton(EKeys::ThumbMouseButton, 3);
+				AddMouseButton(EKeys::ThumbMouseButton2, 4);
+
+				AddAxis(EKeys::Gamepad_LeftX,  {ImGuiKey_GamepadLStickLeft, ImGuiKey_GamepadLStickRight});
+				AddAxis(EKeys::Gamepad_LeftY,  {ImGuiKey_GamepadLStickDown, ImGuiKey_GamepadLStickUp});
+				AddAxis(EKeys::Gamepad_RightX, {ImGuiKey_GamepadRStickLeft, ImGuiKey_GamepadRStickRight});
+				AddAxis(EKeys::Gamepad_RightY, {ImGuiKey_GamepadRStickDown, ImGuiKey_GamepadRStickUp});
+			}
+
+			void AddKey(const FKey& Key, ImGuiKey ImKey) { FindOrAdd(Key).Key = ImKey; }
+			void AddMouseButton(const FKey& Key, int32 MouseIndex) { FindOrAdd(Key).MouseIndex = MouseIndex; }
+			void AddAxis(const FKey& Key, const ImGuiGamepadKeyRange& Axis) { FindOrAdd(Key).Axis = Axis; }
+
+			FKeyMapping& FindOrAdd(const FKey& Key)
+			{
+				FKeyMapping& Mapping = const_cast<FKeyMapping&>(Find(Key));
+				if (Mapping.KeyName.IsNone())
+				{
+					Mapping.KeyName = Key.GetFName();
+					NumMappings++;
+					checkf(NumMappings <= NumSlots / 4, TEXT("Too many key mappings (%d) for a table with %d slots."), NumMappings, NumSlots);
+				}
+				return Mapping;
+			}
+
+			static FORCEINLINE uint32 GetSlot(const FName& KeyName)
+			{
+				// Fibonacci hashing spreads name indices, which are often close to each other.
+				return (GetTypeHash(KeyName) * 2654435769u) >> (32 - SlotBits);
+			}
+
+			static constexpr uint32 SlotBits = 9;
+			static constexpr uint32 NumSlots = 1u << SlotBits;
+			static constexpr uint32 SlotMask = NumSlots - 1;
+
+			FKeyMapping Mappings[NumSlots];
+			int32 NumMappings = 0;
+		};
 	}
 
 	ImGuiKey GetImGuiKey(const FKey& Key)
 	{
-		if (UnrealToImGuiKeyMap.Contains(Key))
-		{
-			return UnrealToImGuiKeyMap[Key];
-		}
-
-		return ImGuiKey_None;
+		return FKeyMappingTable::Get().Find(Key).Key;
 	}
 
 	// Simple transform mapping key codes to 0-511 range used in ImGui.
@@ -194,22 +254,12 @@ namespace ImGuiInterops
 
 	uint32 GetMouseIndex(const FKey& MouseButton)
 	{
-		if (UnrealToImGuiMouseMap.Contains(MouseButton))
-		{
-			return UnrealToImGuiMouseMap[MouseButton];
-		}
-
-		return -1;
+		return FKeyMappingTable::Get().Find(MouseButton).MouseIndex;
 	}
 
 	ImGuiGamepadKeyRange GetImGuiNavigationAxis(const FKey& Key)
 	{
-		if (UnrealToImGuiAnalogAxis.Contains(Key))
-		{
-			return UnrealToImGuiAnalogAxis[Key];
-		}
-		
-		return {};
+		return FKeyMappingTable::Get().Find(Key).Axis;
 	}
 
 	EMouseCursor::Type ToSlateMouseCursor(ImGuiMouseCursor MouseCursor)
@@ -0,0 +1,522 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiLogWindow.h"
+
+#include "ImGuiModuleProperties.h"
+
+#include <Algo/BinarySearch.h>
+#include <Async/Async.h>
+#include <CoreGlobals.h>
+#include <Misc/OutputDeviceRedirector.h>
+#include <Misc/StringBuilder.h>
+
+#include <imgui.h>
+
+
+namespace
+{
+	// Verbosity levels that can be selected in the window, in the same order as names in the combo box.
+	constexpr const char* VerbosityNames = "All\0Log\0Display\0Warnings\0Errors\0";
+	constexpr ELogVerbosity::Type VerbosityLevels[] = {
+		ELogVerbosity::All, ELogVerbosity::Log, ELogVerbosity::Display, ELogVerbosity::Warning, ELogVerbosity::Error };
+
+	// Append text converted to UTF-8, for as long as it fits in the output.
+	ANSICHAR* AppendUTF8(ANSICHAR* Out, const ANSICHAR* OutEnd, const TCHAR* Begin, const TCHAR* End)
+	{
+		for (const TCHAR* Char = Begin; Char < End; Char++)
+		{
+			uint32 Codepoint = static_cast<uint32>(*Char);
+			if (Codepoint < 0x80)
+			{
+				if (Out == OutEnd)
+				{
+					break;
+				}
+				*Out++ = static_cast<ANSICHAR>(Codepoint);
+				continue;
+			}
+
+			// Combine UTF-16 surrogate pairs.
+			if (Codepoint >= 0xD800 && Codepoint <= 0xDBFF && Char + 1 < End
+				&& static_cast<uint32>(Char[1]) >= 0xDC00 && static_cast<uint32>(Char[1]) <= 0xDFFF)
+			{
+				Codepoint = 0x10000 + ((Codepoint - 0xD800) << 10) + (static_cast<uint32>(*++Char) - 0xDC00);
+			}
+
+			const int32 Size = Codepoint < 0x800 ? 2 : Codepoint < 0x10000 ? 3 : 4;
+			if (OutEnd - Out < Size)
+			{
+				break;
+			}
+
+			switch (Size)
+			{
+			case 2:
+				*Out++ = static_cast<ANSICHAR>(0xC0 | (Codepoint >> 6));
+				break;
+			case 3:
+				*Out++ = static_cast<ANSICHAR>(0xE0 | (Codepoint >> 12));
+				*Out++ = static_cast<ANSICHAR>(0x80 | ((Codepoint >> 6) & 0x3F));
+				break;
+			default:
+				*Out++ = static_cast<ANSICHAR>(0xF0 | (Codepoint >> 18));
+				*Out++ = static_cast<ANSICHAR>(0x80 | ((Codepoint >> 12) & 0x3F));
+				*Out++ = static_cast<ANSICHAR>(0x80 | ((Codepoint >> 6) & 0x3F));
+				break;
+			}
+			*Out++ = static_cast<ANSICHAR>(0x80 | (Codepoint & 0x3F));
+		}
+
+		return Out;
+	}
+}
+
+//====================================================================================================
+// FImGuiLogSink
+//====================================================================================================
+
+FImGuiLogSink::FImGuiLogSink()
+	: Slots(MakeUnique<FSlot[]>(Capacity))
+{
+	static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
+	for (int32 Index = 0; Index < Capacity; Index++)
+	{
+		Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+	}
+}
+
+void FImGuiLogSink::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
+{
+	if (!V || Verbosity == ELogVerbosity::SetColor)
+	{
+		return;
+	}
+
+	const ELogVerbosity::Type LineVerbosity = static_cast<ELogVerbosity::Type>(Verbosity & ELogVerbosity::VerbosityMask);
+
+	// Lines are prefixed with category and verbosity, like in the output log.
+	TStringBuilder<256> Prefix;
+	if (!Category.IsNone())
+	{
+		Prefix << Category << TEXT(": ");
+	}
+	if (LineVerbosity != ELogVerbosity::Log)
+	{
+		Prefix << ToString(LineVerbosity) << TEXT(": ");
+	}
+
+	// Every line of a multi-line message is added separately, so it can be filtered and drawn on its own.
+	const TCHAR* LineBegin = V;
+	while (true)
+	{
+		const TCHAR* LineEnd = LineBegin;
+		while (*LineEnd && *LineEnd != TEXT('\n'))
+		{
+			LineEnd++;
+		}
+
+		AddLine(LineVerbosity, *Prefix, LineBegin, (LineEnd > LineBegin && LineEnd[-1] == TEXT('\r')) ? LineEnd - 1 : LineEnd);
+
+		if (!*LineEnd || !LineEnd[1])
+		{
+			break;
+		}
+		LineBegin = LineEnd + 1;
+	}
+}
+
+void FImGuiLogSink::AddLine(ELogVerbosity::Type Verbosity, const TCHAR* Prefix, const TCHAR* Begin, const TCHAR* End)
+{
+	// Claim a slot at the current position. If the slot at that position wasn't read yet, the buffer is full.
+	FSlot* Slot = nullptr;
+	uint64 Position = EnqueuePosition.load(std::memory_order_relaxed);
+	while (true)
+	{
+		Slot = &Slots[Position & (Capacity - 1)];
+		const int64 Difference = static_cast<int64>(Slot->Sequence.load(std::memory_order_acquire) - Position);
+		if (Difference == 0)
+		{
+			if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (Difference < 0)
+		{
+			DroppedLines.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		else
+		{
+			Position = EnqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	// Slot is owned by this thread until its sequence is updated.
+	ANSICHAR* Out = AppendUTF8(Slot->Text, Slot->Text + MaxLineLength, Prefix, Prefix + FCString::Strlen(Prefix));
+	Out = AppendUTF8(Out, Slot->Text + MaxLineLength, Begin, End);
+
+	Slot->Verbosity = static_cast<uint8>(Verbosity);
+	Slot->Length = static_cast<uint16>(Out - Slot->Text);
+	Slot->Sequence.store(Position + 1, std::memory_order_release);
+}
+
+void FImGuiLogSink::Drain(TFunctionRef<void(ELogVerbosity::Type Verbosity, const ANSICHAR* Text, int32 Length)> Callback)
+{
+	// Limited to one pass over the buffer, so producers can't keep the consumer busy.
+	for (int32 Count = 0; Count < Capacity; Count++)
+	{
+		FSlot& Slot = Slots[DequeuePosition & (Capacity - 1)];
+		if (Slot.Sequence.load(std::memory_order_acquire) != DequeuePosition + 1)
+		{
+			break;
+		}
+
+		Callback(static_cast<ELogVerbosity::Type>(Slot.Verbosity), Slot.Text, Slot.Length);
+
+		// Release the slot for the next pass over the buffer.
+		Slot.Sequence.store(DequeuePosition + Capacity, std::memory_order_release);
+		DequeuePosition++;
+	}
+}
+
+//====================================================================================================
+// FImGuiLogWindow
+//====================================================================================================
+
+FImGuiLogWindow::FFilter::FFilter(const char* Text, uint8 InMaxVerbosity)
+	: Terms(Text)
+	, MaxVerbosity(InMaxVerbosity)
+{
+}
+
+bool FImGuiLogWindow::FFilter::IsActive() const
+{
+	return Terms.IsActive() || MaxVerbosity < ELogVerbosity::All;
+}
+
+bool FImGuiLogWindow::FFilter::PassFilter(const ANSICHAR* Line, uint8 Verbosity) const
+{
+	return Verbosity <= MaxVerbosity && Terms.PassFilter(Line);
+}
+
+FImGuiLogWindow::FImGuiLogWindow(FImGuiModuleProperties& InProperties)
+	: Properties(InProperties)
+{
+}
+
+FImGuiLogWindow::~FImGuiLogWindow()
+{
+	if (Sink && GLog)
+	{
+		GLog->RemoveOutputDevice(Sink.Get());
+	}
+
+	// Search tasks own everything they use, so they only need to stop.
+	for (auto& Pair : Views)
+	{
+		CancelSearch(*Pair.Value);
+	}
+}
+
+void FImGuiLogWindow::StartCapture()
+{
+#if !IMGUI_RUNTIME_LITE
+	if (GLog)
+	{
+		Sink = MakeUnique<FImGuiLogSink>();
+		GLog->AddOutputDevice(Sink.Get());
+	}
+#endif
+}
+
+void FImGuiLogWindow::Tick()
+{
+	// Sessions that never show the log don't pay for formatting every logged line.
+	if (!Sink && Properties.ShowLog())
+	{
+		StartCapture();
+	}
+
+	if (Sink)
+	{
+		Sink->Drain([this](ELogVerbosity::Type Verbosity, const ANSICHAR* Text, int32 Length)
+		{
+			AddLine(Verbosity, Text, Length);
+		});
+		DroppedLines += Sink->ConsumeDroppedLines();
+	}
+}
+
+void FImGuiLogWindow::AddLine(ELogVerbosity::Type Verbosity, const ANSICHAR* Text, int32 Length)
+{
+	OpenPage.LineOffsets.Add(OpenPage.Text.Num());
+	OpenPage.Verbosities.Add(static_cast<uint8>(Verbosity));
+	OpenPage.Text.Append(Text, Length);
+	OpenPage.Text.Add('\0');
+
+	if (OpenPage.Num() == LinesPerPage)
+	{
+		Pages.Add(MakeShared<FPage, ESPMode::ThreadSafe>(MoveTemp(OpenPage)));
+		OpenPage = FPage();
+
+		if (Pages.Num() > MaxPages)
+		{
+			Pages.RemoveAt(0);
+			FirstLine += LinesPerPage;
+		}
+	}
+}
+
+void FImGuiLogWindow::Clear()
+{
+	FirstLine = GetEndLine();
+	Pages.Reset();
+	OpenPage = FPage();
+	DroppedLines = 0;
+
+	for (auto& Pair : Views)
+	{
+		FView& View = *Pair.Value;
+		CancelSearch(View);
+		View.Matches.Reset();
+		View.MatchedEndLine = FirstLine;
+	}
+}
+
+const ANSICHAR* FImGuiLogWindow::GetLine(int64 Line, uint8& OutVerbosity, int32& OutLength) const
+{
+	const int64 Offset = Line - FirstLine;
+	const int32 PageIndex = FMath::Min(static_cast<int32>(Offset / LinesPerPage), Pages.Num());
+	const FPage& Page = PageIndex < Pages.Num() ? *Pages[PageIndex] : OpenPage;
+	const int32 Index = static_cast<int32>(Offset - static_cast<int64>(PageIndex) * LinesPerPage);
+
+	// Lines are null-terminated, so the next line begins one character after the end.
+	const int32 Begin = Page.LineOffsets[Index];
+	const int32 End = (Index + 1 < Page.Num() ? Page.LineOffsets[Index + 1] : Page.Text.Num()) - 1;
+
+	OutVerbosity = Page.Verbosities[Index];
+	OutLength = End - Begin;
+	return Page.Text.GetData() + Begin;
+}
+
+void FImGuiLogWindow::StartSearch(FView& View)
+{
+	CancelSearch(View);
+
+	View.Filter = FFilter(View.FilterText, VerbosityLevels[View.VerbosityIndex]);
+	View.bFiltered = View.Filter.IsActive();
+	View.Matches.Reset();
+	View.MatchedEndLine = GetEndLine();
+
+	if (!View.bFiltered)
+	{
+		return;
+	}
+
+	// Full pages are searched in the background. Task holds references to pages, so they stay valid even if they are
+	// removed from the history in the meantime.
+	View.SearchCancelled = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+	View.SearchTask = Async(EAsyncExecution::ThreadPool,
+		[SearchPages = Pages, SearchFirstLine = FirstLine, Filter = View.Filter, bCancelled = View.SearchCancelled]()
+		{
+			TArray<int64> Matches;
+			for (int32 PageIndex = 0; PageIndex < SearchPages.Num() && !bCancelled->load(std::memory_order_relaxed); PageIndex++)
+			{
+				const FPage& Page = *SearchPages[PageIndex];
+				const int64 PageFirstLine = SearchFirstLine + static_cast<int64>(PageIndex) * LinesPerPage;
+				for (int32 Index = 0; Index < Page.Num(); Index++)
+				{
+					if (Filter.PassFilter(Page.Text.GetData() + Page.LineOffsets[Index], Page.Verbosities[Index]))
+					{
+						Matches.Add(PageFirstLine + Index);
+					}
+				}
+			}
+			return Matches;
+		});
+
+	// Open page is small enough to search immediately.
+	const int64 OpenPageFirstLine = View.MatchedEndLine - OpenPage.Num();
+	for (int32 Index = 0; Index < OpenPage.Num(); Index++)
+	{
+		if (View.Filter.PassFilter(OpenPage.Text.GetData() + OpenPage.LineOffsets[Index], OpenPage.Verbosities[Index]))
+		{
+			View.PendingMatches.Add(OpenPageFirstLine + Index);
+		}
+	}
+}
+
+void FImGuiLogWindow::CancelSearch(FView& View)
+{
+	if (View.SearchCancelled)
+	{
+		View.SearchCancelled->store(true, std::memory_order_relaxed);
+		View.SearchCancelled.Reset();
+	}
+
+	View.SearchTask.Reset();
+	View.PendingMatches.Reset();
+}
+
+void FImGuiLogWindow::UpdateMatches(FView& View)
+{
+	const int64 EndLine = GetEndLine();
+	if (!View.bFiltered)
+	{
+		View.MatchedEndLine = EndLine;
+		return;
+	}
+
+	// Lines added since the last update are checked here, which is cheap compared to searching the whole history.
+	TArray<int64>& NewMatches = View.SearchTask.IsValid() ? View.PendingMatches : View.Matches;
+	for (int64 Line = FMath::Max(View.MatchedEndLine, FirstLine); Line < EndLine; Line++)
+	{
+		uint8 Verbosity;
+		int32 Length;
+		const ANSICHAR* Text = GetLine(Line, Verbosity, Length);
+		if (View.Filter.PassFilter(Text, Verbosity))
+		{
+			NewMatches.Add(Line);
+		}
+	}
+	View.MatchedEndLine = EndLine;
+
+	// Search results cover lines before the pending matches.
+	if (View.SearchTask.IsValid() && View.SearchTask.IsReady())
+	{
+		View.Matches = View.SearchTask.Consume();
+		View.Matches.Append(View.PendingMatches);
+		View.PendingMatches.Reset();
+		View.SearchTask.Reset();
+		View.SearchCancelled.Reset();
+	}
+
+	// Forget matches of lines that were removed from the history.
+	const int32 NumRemoved = Algo::LowerBound(View.Matches, FirstLine);
+	if (NumRemoved > 0)
+	{
+		View.Matches.RemoveAt(0, NumRemoved);
+	}
+}
+
+void FImGuiLogWindow::Draw(int32 ContextIndex)
+{
+#if !IMGUI_RUNTIME_LITE
+	if (!Properties.ShowLog())
+	{
+		return;
+	}
+
+	TUniquePtr<FView>& ViewPtr = Views.FindOrAdd(ContextIndex);
+	if (!ViewPtr)
+	{
+		ViewPtr = MakeUnique<FView>();
+	}
+	FView& View = *ViewPtr;
+
+	// After the window was hidden for a while, searching the history again in the background is faster than checking
+	// all the lines added in the meantime.
+	const bool bWasVisible = View.LastDrawFrame + 1 >= GFrameCounter;
+	View.LastDrawFrame = GFrameCounter;
+
+	ImGui::SetNextWindowSize(ImVec2(800.f, 400.f), ImGuiCond_FirstUseEver);
+
+	bool bOpen = true;
+	if (ImGui::Begin("Log", &bOpen))
+	{
+		if (ImGui::Button("Clear"))
+		{
+			Clear();
+		}
+
+		ImGui::SameLine();
+		ImGui::Checkbox("Auto-scroll", &View.bAutoScroll);
+
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 7.f);
+		bool bFilterChanged = ImGui::Combo("##Verbosity", &View.VerbosityIndex, VerbosityNames);
+
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(-FLT_MIN);
+		bFilterChanged |= ImGui::InputTextWithHint("##Filter", "Filter (inc,-exc)", View.FilterText, sizeof(View.FilterText));
+
+		if (bFilterChanged || (!bWasVisible && View.bFiltered && GetEndLine() - View.MatchedEndLine > LinesPerPage))
+		{
+			StartSearch(View);
+		}
+		UpdateMatches(View);
+
+		const int64 NumLines = GetEndLine() - FirstLine;
+		if (View.bFiltered)
+		{
+			ImGui::Text("%d of %lld lines%s", View.Matches.Num(), NumLines, View.SearchTask.IsValid() ? " (searching...)" : "");
+		}
+		else
+		{
+			ImGui::Text("%lld lines", NumLines);
+		}
+
+		if (DroppedLines > 0)
+		{
+			ImGui::SameLine();
+			ImGui::TextDisabled("(%lld dropped)", DroppedLines);
+		}
+
+		ImGui::Separator();
+
+		if (ImGui::BeginChild("Lines", ImVec2(0.f, 0.f), ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar))
+		{
+			ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0.f, 0.f));
+
+			// Only visible lines are drawn.
+			ImGuiListClipper Clipper;
+			Clipper.Begin(View.bFiltered ? View.Matches.Num() : static_cast<int32>(NumLines));
+			while (Clipper.Step())
+			{
+				for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; Row++)
+				{
+					DrawLine(View.bFiltered ? View.Matches[Row] : FirstLine + Row);
+				}
+			}
+			Clipper.End();
+
+			ImGui::PopStyleVar();
+
+			if (View.bAutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+			{
+				ImGui::SetScrollHereY(1.f);
+			}
+		}
+		ImGui::EndChild();
+	}
+	ImGui::End();
+
+	if (!bOpen)
+	{
+		Properties.SetShowLog(false);
+	}
+#endif // !IMGUI_RUNTIME_LITE
+}
+
+void FImGuiLogWindow::DrawLine(int64 Line) const
+{
+	uint8 Verbosity;
+	int32 Length;
+	const ANSICHAR* Text = GetLine(Line, Verbosity, Length);
+
+	const bool bError = Verbosity == ELogVerbosity::Fatal || Verbosity == ELogVerbosity::Error;
+	const bool bWarning = Verbosity == ELogVerbosity::Warning;
+	if (bError || bWarning)
+	{
+		ImGui::PushStyleColor(ImGuiCol_Text, bError ? ImVec4{ 1.f, 0.4f, 0.4f, 1.f } : ImVec4{ 1.f, 0.8f, 0.4f, 1.f });
+	}
+
+	ImGui::TextUnformatted(Text, Text + Length);
+
+	if (bError || bWarning)
+	{
+		ImGui::PopStyleColor();
+	}
+}
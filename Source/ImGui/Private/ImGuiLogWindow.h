@@ -0,0 +1,173 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiDataTable.h"
+
+#include <Async/Future.h>
+#include <Containers/Array.h>
+#include <Containers/Map.h>
+#include <Misc/OutputDevice.h>
+#include <Templates/Function.h>
+#include <Templates/SharedPointer.h>
+#include <Templates/UniquePtr.h>
+
+#include <atomic>
+
+
+class FImGuiModuleProperties;
+
+// Output device receiving log lines from any thread. Lines are formatted by the logging threads and passed through
+// a lock-free multi-producer ring buffer, which is drained by a single consumer. Lines that don't fit in the buffer
+// are dropped and counted.
+class FImGuiLogSink : public FOutputDevice
+{
+public:
+
+	// Number of lines that can wait in the buffer (power of two).
+	static constexpr int32 Capacity = 4096;
+
+	// Longer lines are truncated.
+	static constexpr int32 MaxLineLength = 496;
+
+	FImGuiLogSink();
+
+	//~ FOutputDevice interface
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	virtual bool CanBeUsedOnAnyThread() const override { return true; }
+	virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+	virtual bool IsMemoryOnly() const override { return true; }
+
+	// Pass lines waiting in the buffer to the callback, in the order in which they were added. Must be called from one
+	// thread at a time. Lines added while draining may be left for the next call.
+	void Drain(TFunctionRef<void(ELogVerbosity::Type Verbosity, const ANSICHAR* Text, int32 Length)> Callback);
+
+	// Get and reset the number of lines dropped because the buffer was full.
+	int64 ConsumeDroppedLines() { return DroppedLines.exchange(0, std::memory_order_relaxed); }
+
+private:
+
+	struct FSlot
+	{
+		// Equal to position, when slot is free to write, and to position + 1, when it can be read.
+		std::atomic<uint64> Sequence;
+		uint8 Verbosity;
+		uint16 Length;
+		ANSICHAR Text[MaxLineLength];
+	};
+
+	void AddLine(ELogVerbosity::Type Verbosity, const TCHAR* Prefix, const TCHAR* Begin, const TCHAR* End);
+
+	TUniquePtr<FSlot[]> Slots;
+
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePosition{ 0 };
+	alignas(PLATFORM_CACHE_LINE_SIZE) uint64 DequeuePosition = 0;
+	std::atomic<int64> DroppedLines{ 0 };
+};
+
+// Window showing log output from all threads. Only visible lines are drawn and lines matching a filter are searched
+// for on a background thread, so the window stays responsive with large histories and during log storms.
+class FImGuiLogWindow
+{
+public:
+
+	FImGuiLogWindow(FImGuiModuleProperties& InProperties);
+	~FImGuiLogWindow();
+
+	FImGuiLogWindow(const FImGuiLogWindow&) = delete;
+	FImGuiLogWindow& operator=(const FImGuiLogWindow&) = delete;
+
+	FImGuiLogWindow(FImGuiLogWindow&&) = delete;
+	FImGuiLogWindow& operator=(FImGuiLogWindow&&) = delete;
+
+	// Move lines logged since the last tick to the history. Capture starts in the first tick in which the window is
+	// visible, and lines logged before that are not shown. Should be called on the game thread, before drawing.
+	void Tick();
+
+	// Draw the log window, if it is visible.
+	void Draw(int32 ContextIndex);
+
+private:
+
+	// Lines of the history are stored in pages. Full pages are immutable and shared with search tasks.
+	struct FPage
+	{
+		// Null-terminated lines.
+		TArray<ANSICHAR> Text;
+		TArray<int32> LineOffsets;
+		TArray<uint8> Verbosities;
+
+		int32 Num() const { return LineOffsets.Num(); }
+	};
+
+	using FPagePtr = TSharedPtr<const FPage, ESPMode::ThreadSafe>;
+
+	// Text terms, parsed like in data tables (see FImGuiTableFilter), and the maximum verbosity.
+	struct FFilter
+	{
+		FImGuiTableFilter Terms;
+		uint8 MaxVerbosity = ELogVerbosity::All;
+
+		FFilter() = default;
+		FFilter(const char* Text, uint8 InMaxVerbosity);
+
+		bool IsActive() const;
+		bool PassFilter(const ANSICHAR* Line, uint8 Verbosity) const;
+	};
+
+	// State of the window in a single context.
+	struct FView
+	{
+		char FilterText[256] = {};
+		int32 VerbosityIndex = 0;
+		bool bAutoScroll = true;
+
+		uint64 LastDrawFrame = 0;
+
+		FFilter Filter;
+		bool bFiltered = false;
+
+		// Sorted numbers of matching lines, when filtered.
+		TArray<int64> Matches;
+
+		// Lines before this one were already checked against the filter.
+		int64 MatchedEndLine = 0;
+
+		// Search of full pages running in the background. Lines after them are checked on the game thread, with matches
+		// collected in pending matches until the search is finished.
+		TFuture<TArray<int64>> SearchTask;
+		TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> SearchCancelled;
+		TArray<int64> PendingMatches;
+	};
+
+	void StartCapture();
+
+	void AddLine(ELogVerbosity::Type Verbosity, const ANSICHAR* Text, int32 Length);
+	void Clear();
+
+	int64 GetEndLine() const { return FirstLine + static_cast<int64>(Pages.Num()) * LinesPerPage + OpenPage.Num(); }
+	const ANSICHAR* GetLine(int64 Line, uint8& OutVerbosity, int32& OutLength) const;
+
+	void StartSearch(FView& View);
+	void CancelSearch(FView& View);
+	void UpdateMatches(FView& View);
+
+	void DrawLine(int64 Line) const;
+
+	static constexpr int32 LinesPerPage = 1024;
+	static constexpr int32 MaxPages = 256;
+
+	FImGuiModuleProperties& Properties;
+
+	TUniquePtr<FImGuiLogSink> Sink;
+
+	TArray<FPagePtr> Pages;
+	FPage OpenPage;
+
+	// Number of the first line in the history.
+	int64 FirstLine = 0;
+
+	int64 DroppedLines = 0;
+
+	TMap<int32, TUniquePtr<FView>> Views;
+};
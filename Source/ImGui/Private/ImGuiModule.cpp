@@ -13,6 +13,7 @@
 #include "Editor/ImGuiEditor.h"
 #endif
 
+#include <Async/Async.h>
 #include <Interfaces/IPluginManager.h>
 
 
@@ -39,9 +40,12 @@ static FImGuiEditor* ImGuiEditor = nullptr;
 
 #if IMGUI_WITH_OBSOLETE_DELEGATES
 
+#if IMGUI_WITH_DELEGATES
+
 #if WITH_EDITOR
 FImGuiDelegateHandle FImGuiModule::AddEditorImGuiDelegate(const FImGuiDelegate& Delegate)
 {
+	FImGuiModuleManager::RequestDrawActivation(TEXT("draw delegate bound"));
 	return { FImGuiDelegatesContainer::Get().OnWorldDebug(Utilities::EDITOR_CONTEXT_INDEX).Add(Delegate),
 		EDelegateCategory::Default, Utilities::EDITOR_CONTEXT_INDEX };
 }
@@ -49,18 +53,21 @@ FImGuiDelegateHandle FImGuiModule::AddEditorImGuiDelegate(const FImGuiDelegate&
 
 FImGuiDelegateHandle FImGuiModule::AddWorldImGuiDelegate(const FImGuiDelegate& Delegate)
 {
+	FImGuiModuleManager::RequestDrawActivation(TEXT("draw delegate bound"));
 	const int32 ContextIndex = Utilities::GetWorldContextIndex((UWorld*)GWorld);
 	return { FImGuiDelegatesContainer::Get().OnWorldDebug(ContextIndex).Add(Delegate), EDelegateCategory::Default, ContextIndex };
 }
 
 FImGuiDelegateHandle FImGuiModule::AddWorldImGuiDelegate(const UWorld* World, const FImGuiDelegate& Delegate)
 {
+	FImGuiModuleManager::RequestDrawActivation(TEXT("draw delegate bound"));
 	const int32 ContextIndex = Utilities::GetWorldContextIndex(World);
 	return { FImGuiDelegatesContainer::Get().OnWorldDebug(ContextIndex).Add(Delegate), EDelegateCategory::Default, ContextIndex };
 }
 
 FImGuiDelegateHandle FImGuiModule::AddMultiContextImGuiDelegate(const FImGuiDelegate& Delegate)
 {
+	FImGuiModuleManager::RequestDrawActivation(TEXT("draw delegate bound"));
 	return { FImGuiDelegatesContainer::Get().OnMultiContextDebug().Add(Delegate), EDelegateCategory::MultiContext };
 }
 
@@ -72,10 +79,45 @@ void FImGuiModule::RemoveImGuiDelegate(const FImGuiDelegateHandle& Handle)
 	}
 	else
 	{
-		FImGuiDelegatesContainer::Get().OnWorldDebug(Handle.Index).Remove(Handle.Handle);
+		if (FImGuiWorldDelegates* Delegates = FImGuiDelegatesContainer::Get().FindWorldDelegates(Handle.Index))
+		{
+			Delegates->Debug.Remove(Handle.Handle);
+		}
 	}
 }
 
+#else
+
+// Without draw delegates, nothing would ever call bound delegates, so they are not stored.
+
+#if WITH_EDITOR
+FImGuiDelegateHandle FImGuiModule::AddEditorImGuiDelegate(const FImGuiDelegate& Delegate)
+{
+	return {};
+}
+#endif
+
+FImGuiDelegateHandle FImGuiModule::AddWorldImGuiDelegate(const FImGuiDelegate& Delegate)
+{
+	return {};
+}
+
+FImGuiDelegateHandle FImGuiModule::AddWorldImGuiDelegate(const UWorld* World, const FImGuiDelegate& Delegate)
+{
+	return {};
+}
+
+FImGuiDelegateHandle FImGuiModule::AddMultiContextImGuiDelegate(const FImGuiDelegate& Delegate)
+{
+	return {};
+}
+
+void FImGuiModule::RemoveImGuiDelegate(const FImGuiDelegateHandle& Handle)
+{
+}
+
+#endif // IMGUI_WITH_DELEGATES
+
 #endif // IMGUI_WITH_OBSOLETE_DELEGATES
 
 FImGuiTextureHandle FImGuiModule::FindTextureHandle(const FName& Name)
@@ -112,6 +154,24 @@ void FImGuiModule::RebuildFontAtlas()
 	}
 }
 
+void FImGuiModule::SetWorldDPIScale(const UWorld* World, float Scale)
+{
+	if (ImGuiModuleManager)
+	{
+#if WITH_EDITOR
+		// Like in FImGuiContextManager::GetWorldContextData, anything other than a game world uses the editor context.
+		const bool bIsGameWorld = World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+		const int32 ContextIndex = bIsGameWorld ? Utilities::GetWorldContextIndex(*World) : Utilities::EDITOR_CONTEXT_INDEX;
+#else
+		const int32 ContextIndex = Utilities::STANDALONE_GAME_CONTEXT_INDEX;
+#endif
+		if (ContextIndex != Utilities::INVALID_CONTEXT_INDEX)
+		{
+			ImGuiModuleManager->SetContextDPIScale(ContextIndex, Scale);
+		}
+	}
+}
+
 void FImGuiModule::StartupModule()
 {
 	// Initialize handles to allow cross-module redirections. Other handles will always look for parents in the active
@@ -144,6 +204,7 @@ void FImGuiModule::ShutdownModule()
 #if WITH_EDITOR
 	static bool bMoveProperties = true;
 	static FImGuiModuleProperties PropertiesToMove = ImGuiModuleManager->GetProperties();
+	static bool bWasActive = ImGuiModuleManager->IsActive();
 #endif
 
 	// Before we shutdown we need to delete managers that will do all the necessary cleanup.
@@ -191,6 +252,13 @@ void FImGuiModule::ShutdownModule()
 					bMoveProperties = false;
 					LoadedModule.SetProperties(PropertiesToMove);
 				}
+
+				// Module that was in use should stay in use, even if it waits for the first use after startup.
+				if (bWasActive)
+				{
+					bWasActive = false;
+					LoadedModule.ActivateAfterReload();
+				}
 			}
 		}
 	});
@@ -202,6 +270,11 @@ void FImGuiModule::SetProperties(const FImGuiModuleProperties& Properties)
 {
 	ImGuiModuleManager->GetProperties() = Properties;
 }
+
+void FImGuiModule::ActivateAfterReload()
+{
+	ImGuiModuleManager->Activate(TEXT("hot-reload"));
+}
 #endif
 
 FImGuiModuleProperties& FImGuiModule::GetProperties()
@@ -312,6 +385,19 @@ FImGuiModuleLoader FImGuiModuleLoader::Instance;
 // Partial implementations of other classes that needs access to ImGuiModuleManager
 //----------------------------------------------------------------------------------------------------
 
+void FImGuiModuleManager::RequestActivation(const TCHAR* Reason)
+{
+	if (ImGuiModuleManager)
+	{
+		ImGuiModuleManager->Activate(Reason);
+	}
+}
+
+void FImGuiModuleManager::RequestActivationOnGameThread(const TCHAR* Reason)
+{
+	AsyncTask(ENamedThreads::GameThread, [Reason]() { RequestActivation(Reason); });
+}
+
 bool FImGuiTextureHandle::HasValidEntry() const
 {
 	const TextureIndex Index = ImGuiInterops::ToTextureIndex(TextureId);
@@ -14,6 +14,7 @@ const TCHAR* const FImGuiModuleCommands::ToggleGamepadInputSharing = TEXT("ImGui
 const TCHAR* const FImGuiModuleCommands::ToggleMouseInputSharing = TEXT("ImGui.ToggleMouseInputSharing");
 const TCHAR* const FImGuiModuleCommands::SetMouseInputSharing = TEXT("ImGui.SetMouseInputSharing");
 const TCHAR* const FImGuiModuleCommands::ToggleDemo = TEXT("ImGui.ToggleDemo");
+const TCHAR* const FImGuiModuleCommands::ToggleLog = TEXT("ImGui.ToggleLog");
 
 FImGuiModuleCommands::FImGuiModuleCommands(FImGuiModuleProperties& InProperties)
 	: Properties(InProperties)
@@ -41,6 +42,9 @@ FImGuiModuleCommands::FImGuiModuleCommands(FImGuiModuleProperties& InProperties)
 	, ToggleDemoCommand(ToggleDemo,
 		TEXT("Toggle ImGui demo."),
 		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::ToggleDemoImpl))
+	, ToggleLogCommand(ToggleLog,
+		TEXT("Toggle ImGui log window."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::ToggleLogImpl))
 {
 }
 
@@ -93,3 +97,8 @@ void FImGuiModuleCommands::ToggleDemoImpl()
 {
 	Properties.ToggleDemo();
 }
+
+void FImGuiModuleCommands::ToggleLogImpl()
+{
+	Properties.ToggleLog();
+}
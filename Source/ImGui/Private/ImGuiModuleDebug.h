@@ -8,8 +8,17 @@
 // Module-wide debug symbols and loggers.
 
 
-// If enabled, it activates debug code and console variables that in normal usage are hidden.
+// If enabled, it activates debug code and console variables that in normal usage are hidden. Can be enabled here or in
+// module definitions.
+#ifndef IMGUI_MODULE_DEVELOPER
 #define IMGUI_MODULE_DEVELOPER 0
+#endif
+
+// Runtime lite builds never include debug code.
+#if IMGUI_RUNTIME_LITE
+#undef IMGUI_MODULE_DEVELOPER
+#define IMGUI_MODULE_DEVELOPER 0
+#endif
 
 
 // Input Handler logger (used also in non-developer mode to raise problems with handler extensions).
@@ -2,51 +2,74 @@
 
 #include "ImGuiModuleManager.h"
 
+#include "ImGuiDebugDrawQueue.h"
+#include "ImGuiDeferredQueue.h"
 #include "ImGuiInteroperability.h"
+#include "Utilities/TextureCompression.h"
 #include "Utilities/WorldContextIndex.h"
 
 #include <Framework/Application/SlateApplication.h>
+#include <HAL/PlatformTime.h>
 #include <Modules/ModuleManager.h>
 
 #include <imgui.h>
 
 
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiModule, Log, All);
+
 // High enough z-order guarantees that ImGui output is rendered on top of the game UI.
 static constexpr int32 IMGUI_WIDGET_Z_ORDER = 10000;
 
-// Module texture names.
+// Module texture names. Font atlas textures are named by the context manager, one per DPI scale.
 const static FName PlainTextureName = "ImGuiModule_Plain";
-const static FName FontAtlasTextureName = "ImGuiModule_FontAtlas";
+
+namespace
+{
+	// Logs the duration of a single startup step when going out of scope.
+	struct FScopedStartupStep
+	{
+		FScopedStartupStep(const TCHAR* InName)
+			: Name(InName)
+			, StartTime(FPlatformTime::Seconds())
+		{
+		}
+
+		~FScopedStartupStep()
+		{
+			UE_LOG(LogImGuiModule, Log, TEXT("Startup step '%s' took %.2f ms."), Name, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		}
+
+		const TCHAR* Name;
+		double StartTime;
+	};
+}
 
 FImGuiModuleManager::FImGuiModuleManager()
 	: Commands(Properties)
 	, Settings(Properties, Commands)
 	, ImGuiDemo(Properties)
+	, LogWindow(Properties)
 	, ContextManager(Settings)
+	, InputRecorder(ContextManager)
 {
 	// Register in context manager to get information whenever a new context proxy is created.
 	ContextManager.OnContextProxyCreated.AddRaw(this, &FImGuiModuleManager::OnContextProxyCreated);
 
-	// Typically we will use viewport created events to add widget to new game viewports.
-	ViewportCreatedHandle = UGameViewportClient::OnViewportCreated().AddRaw(this, &FImGuiModuleManager::OnViewportCreated);
-
-	// Try to register tick delegate (it may fail if Slate application isn't yet ready).
-	RegisterTick();
-
-	// If we failed to register, create an initializer that will do it later.
-	if (!IsTickRegistered())
+	// With lazy startup, the remaining initialization waits until the module is used for the first time. Runtime lite
+	// builds always start lazily.
+	Settings.OnLazyStartupChanged.AddRaw(this, &FImGuiModuleManager::OnLazyStartupChanged);
+	if (!Settings.LazyStartup() && !IMGUI_RUNTIME_LITE)
 	{
-		CreateTickInitializer();
+		Activate(TEXT("module startup"));
 	}
-
-	// We need to add widgets to active game viewports as they won't generate on-created events. This is especially
-	// important during hot-reloading.
-	AddWidgetsToActiveViewports();
 }
 
 FImGuiModuleManager::~FImGuiModuleManager()
 {
+	Settings.OnLazyStartupChanged.RemoveAll(this);
 	ContextManager.OnFontAtlasBuilt.RemoveAll(this);
+	ContextManager.OnFontAtlasReleased.RemoveAll(this);
+	Settings.OnFontAtlasTextureFormatChanged.RemoveAll(this);
 
 	// We are no longer interested with adding widgets to viewports.
 	if (ViewportCreatedHandle.IsValid())
@@ -74,6 +97,52 @@ FImGuiModuleManager::~FImGuiModuleManager()
 	UnregisterTick();
 }
 
+void FImGuiModuleManager::Activate(const TCHAR* Reason)
+{
+	if (bIsActive)
+	{
+		return;
+	}
+
+	bIsActive = true;
+
+	UE_LOG(LogImGuiModule, Log, TEXT("Activating ImGui module (%s)."), Reason);
+	FScopedStartupStep ActivationStep(TEXT("Activation"));
+
+	{
+		FScopedStartupStep Step(TEXT("Font atlas"));
+		ContextManager.Initialize();
+	}
+
+	// Typically we will use viewport created events to add widget to new game viewports.
+	ViewportCreatedHandle = UGameViewportClient::OnViewportCreated().AddRaw(this, &FImGuiModuleManager::OnViewportCreated);
+
+	// Try to register tick delegate (it may fail if Slate application isn't yet ready).
+	RegisterTick();
+
+	// If we failed to register, create an initializer that will do it later.
+	if (!IsTickRegistered())
+	{
+		CreateTickInitializer();
+	}
+
+	{
+		// We need to add widgets to active game viewports as they won't generate on-created events. This is especially
+		// important during hot-reloading and lazy startup.
+		FScopedStartupStep Step(TEXT("Viewport widgets"));
+		AddWidgetsToActiveViewports();
+	}
+}
+
+void FImGuiModuleManager::OnLazyStartupChanged(bool bLazy)
+{
+	// Already active manager stays active, but a manager waiting for the first use shouldn't wait any longer.
+	if (!bLazy && !IMGUI_RUNTIME_LITE)
+	{
+		Activate(TEXT("lazy startup disabled"));
+	}
+}
+
 void FImGuiModuleManager::RebuildFontAtlas()
 {
 	ContextManager.RebuildFontAtlas();
@@ -87,6 +156,8 @@ void FImGuiModuleManager::LoadTextures()
 	{
 		bTexturesLoaded = true;
 
+		FScopedStartupStep Step(TEXT("Textures"));
+
 		TextureManager.InitializeErrorTexture(FColor::Magenta);
 
 		// Create an empty texture at index 0. We will use it for ImGui outputs with null texture id.
@@ -94,26 +165,82 @@ void FImGuiModuleManager::LoadTextures()
 
 		// Register for atlas built events, so we can rebuild textures.
 		ContextManager.OnFontAtlasBuilt.AddRaw(this, &FImGuiModuleManager::BuildFontAtlasTexture);
+		ContextManager.OnFontAtlasReleased.AddRaw(this, &FImGuiModuleManager::ReleaseFontAtlasTexture);
+		Settings.OnFontAtlasTextureFormatChanged.AddRaw(this, &FImGuiModuleManager::OnFontAtlasTextureFormatChanged);
 
-		BuildFontAtlasTexture();
+		ContextManager.ForEachFontAtlas([this](ImFontAtlas& Fonts, const FName& TextureName)
+		{
+			BuildFontAtlasTexture(Fonts, TextureName, { 0, 0, Fonts.TexWidth, Fonts.TexHeight });
+		});
 	}
 }
 
-void FImGuiModuleManager::BuildFontAtlasTexture()
+void FImGuiModuleManager::BuildFontAtlasTexture(ImFontAtlas& Fonts, const FName& TextureName, const FIntRect& DirtyRegion)
 {
 	// Create a font atlas texture.
-	ImFontAtlas& Fonts = ContextManager.GetFontAtlas();
-
 	unsigned char* Pixels;
 	int Width, Height, Bpp;
-	Fonts.GetTexDataAsRGBA32(&Pixels, &Width, &Height, &Bpp);
+	Fonts.GetTexDataAsAlpha8(&Pixels, &Width, &Height);
+
+	TFunction<void(uint8*)> PixelsCleanup = [](uint8*) {};
+	EPixelFormat PixelFormat = PF_B8G8R8A8;
+
+	// Glyphs only need coverage, so if possible, we store it in the alpha channel of a compressed texture with white
+	// color. This works with the same shaders as RGBA textures and uses 1 byte per pixel.
+	const bool bCompress = Settings.GetFontAtlasTextureFormat() == EImGuiFontAtlasTextureFormat::Compressed
+		&& GPixelFormats[PF_DXT5].Supported
+		&& Width % Utilities::TextureBlockSize == 0 && Height % Utilities::TextureBlockSize == 0;
+
+	if (bCompress)
+	{
+		uint8* CompressedPixels = new uint8[Utilities::GetDXT5DataSize(Width, Height)];
+		Utilities::EncodeAlpha8AsDXT5(Pixels, Width, Height, CompressedPixels);
+
+		Pixels = CompressedPixels;
+		Bpp = Utilities::DXT5BlockBytes;
+		PixelsCleanup = [](uint8* Data) { delete[] Data; };
+		PixelFormat = PF_DXT5;
+	}
+	else
+	{
+		Fonts.GetTexDataAsRGBA32(&Pixels, &Width, &Height, &Bpp);
+	}
 
-	const TextureIndex FontsTexureIndex = TextureManager.CreateTexture(FontAtlasTextureName, Width, Height, Bpp, Pixels);
+	// If possible, update only the region that changed since the last build.
+	TextureIndex FontsTexureIndex = TextureManager.FindTextureIndex(TextureName);
+	if (FontsTexureIndex == INDEX_NONE
+		|| !TextureManager.UpdateTexture(FontsTexureIndex, Width, Height, Bpp, Pixels, DirtyRegion, PixelsCleanup, PixelFormat))
+	{
+		FontsTexureIndex = TextureManager.CreateTexture(TextureName, Width, Height, Bpp, Pixels, PixelsCleanup, PixelFormat);
+	}
 
 	// Set the font texture index in the ImGui.
 	Fonts.TexID = ImGuiInterops::ToImTextureID(FontsTexureIndex);
 }
 
+void FImGuiModuleManager::OnFontAtlasTextureFormatChanged(EImGuiFontAtlasTextureFormat Format)
+{
+	// Textures will be recreated, because their format doesn't match.
+	ContextManager.ForEachFontAtlas([this](ImFontAtlas& Fonts, const FName& TextureName)
+	{
+		BuildFontAtlasTexture(Fonts, TextureName, { 0, 0, Fonts.TexWidth, Fonts.TexHeight });
+	});
+}
+
+void FImGuiModuleManager::ReleaseFontAtlasTexture(const FName& TextureName)
+{
+	const TextureIndex FontsTexureIndex = TextureManager.FindTextureIndex(TextureName);
+	if (FontsTexureIndex != INDEX_NONE)
+	{
+		TextureManager.ReleaseTextureResources(FontsTexureIndex);
+	}
+}
+
+void FImGuiModuleManager::SetContextDPIScale(int32 ContextIndex, float Scale)
+{
+	ContextManager.SetContextDPIScale(ContextIndex, Scale);
+}
+
 void FImGuiModuleManager::RegisterTick()
 {
 	// Slate Post-Tick is a good moment to end and advance ImGui frame as it minimises a tearing.
@@ -169,6 +296,17 @@ void FImGuiModuleManager::Tick(float DeltaSeconds)
 {
 	if (IsInGameThread())
 	{
+		// Move lines logged since the last frame to the log window history, before it is drawn.
+		LogWindow.Tick();
+
+#if IMGUI_WITH_DELEGATES
+		// Take commands recorded on other threads since the last frame, to replay them in the next debug frame.
+		FImGuiDeferredQueue::Get().Collect();
+
+		// Take debug primitives added since the last frame, to draw them at the end of this frame.
+		FImGuiDebugDrawQueue::Get().Collect(Settings.GetDPIScaleInfo().GetSlateScale());
+#endif
+
 		// Update context manager to advance all ImGui contexts to the next frame.
 		ContextManager.Tick(DeltaSeconds);
 
@@ -236,5 +374,8 @@ void FImGuiModuleManager::AddWidgetsToActiveViewports()
 
 void FImGuiModuleManager::OnContextProxyCreated(int32 ContextIndex, FImGuiContextProxy& ContextProxy)
 {
+#if !IMGUI_RUNTIME_LITE
 	ContextProxy.OnDraw().AddLambda([this, ContextIndex]() { ImGuiDemo.DrawControls(ContextIndex); });
+	ContextProxy.OnDraw().AddLambda([this, ContextIndex]() { LogWindow.Draw(ContextIndex); });
+#endif
 }
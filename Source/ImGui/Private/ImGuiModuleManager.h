@@ -4,6 +4,8 @@
 
 #include "ImGuiContextManager.h"
 #include "ImGuiDemo.h"
+#include "ImGuiInputRecording.h"
+#include "ImGuiLogWindow.h"
 #include "ImGuiModuleCommands.h"
 #include "ImGuiModuleProperties.h"
 #include "ImGuiModuleSettings.h"
@@ -36,6 +38,37 @@ public:
 
 	void RebuildFontAtlas();
 
+	// Set the DPI scale for a context, overriding the scale from the module settings.
+	void SetContextDPIScale(int32 ContextIndex, float Scale);
+
+	// Whether this manager builds fonts, updates contexts and adds widgets to viewports. Without lazy startup, manager
+	// is activated when created. Otherwise, it waits until the module is used for the first time.
+	bool IsActive() const { return bIsActive; }
+
+	// Activate this manager, if it isn't already active.
+	// @param Reason - Description of what caused the activation, used in the log
+	void Activate(const TCHAR* Reason);
+
+	// Activate the current module manager, if there is one and it isn't already active. Allows activation from places
+	// that don't have access to the manager.
+	// @param Reason - Description of what caused the activation, used in the log
+	static void RequestActivation(const TCHAR* Reason);
+
+	// Request activation after a draw delegate is bound. Runtime lite builds are only activated by explicit use (input
+	// mode, demo or log window), so code that only registers for debug events doesn't cost anything per frame.
+	// @param Reason - Description of what caused the activation, used in the log
+	static void RequestDrawActivation(const TCHAR* Reason)
+	{
+		if (!IMGUI_RUNTIME_LITE)
+		{
+			RequestActivation(Reason);
+		}
+	}
+
+	// Like RequestActivation, but can be called from any thread. Activation happens in a game thread task.
+	// @param Reason - Description of what caused the activation, which needs to outlive the request (e.g. a literal)
+	static void RequestActivationOnGameThread(const TCHAR* Reason);
+
 private:
 
 	FImGuiModuleManager();
@@ -48,7 +81,9 @@ private:
 	FImGuiModuleManager& operator=(FImGuiModuleManager&&) = delete;
 
 	void LoadTextures();
-	void BuildFontAtlasTexture();
+	void BuildFontAtlasTexture(ImFontAtlas& Fonts, const FName& TextureName, const FIntRect& DirtyRegion);
+	void ReleaseFontAtlasTexture(const FName& TextureName);
+	void OnFontAtlasTextureFormatChanged(EImGuiFontAtlasTextureFormat Format);
 
 	bool IsTickRegistered() { return TickDelegateHandle.IsValid(); }
 	void RegisterTick();
@@ -66,6 +101,8 @@ private:
 
 	void OnContextProxyCreated(int32 ContextIndex, FImGuiContextProxy& ContextProxy);
 
+	void OnLazyStartupChanged(bool bLazy);
+
 	// Event that we call after ImGui is updated.
 	FSimpleMulticastDelegate PostImGuiUpdateEvent;
 
@@ -81,9 +118,15 @@ private:
 	// Widget that we add to all created contexts to draw ImGui demo. 
 	FImGuiDemo ImGuiDemo;
 
+	// Window showing log output, added to all created contexts.
+	FImGuiLogWindow LogWindow;
+
 	// Manager for ImGui contexts.
 	FImGuiContextManager ContextManager;
 
+	// Recording and replay of context input.
+	FImGuiInputRecorder InputRecorder;
+
 	// Manager for textures resources.
 	FTextureManager TextureManager;
 
@@ -95,4 +138,5 @@ private:
 	FDelegateHandle ViewportCreatedHandle;
 
 	bool bTexturesLoaded = false;
+	bool bIsActive = false;
 };
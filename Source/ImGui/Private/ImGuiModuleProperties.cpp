@@ -0,0 +1,121 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiModuleProperties.h"
+
+#include "ImGuiModuleManager.h"
+
+#include <Async/MappedFileHandle.h>
+#include <Engine/FontFace.h>
+#include <HAL/PlatformFileManager.h>
+#include <Misc/FileHelper.h>
+
+#include <imgui.h>
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiFonts, Log, All);
+
+namespace
+{
+	// Font file mapped into memory. Platforms that don't support mapping get a copy of the file.
+	struct FMappedFontFile
+	{
+		TUniquePtr<IMappedFileHandle> Handle;
+		TUniquePtr<IMappedFileRegion> Region;
+		TArray<uint8> FallbackData;
+
+		bool Open(const FString& Filename)
+		{
+			Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+			if (Handle && Handle->GetFileSize() > 0)
+			{
+				Region.Reset(Handle->MapRegion(0, Handle->GetFileSize()));
+			}
+
+			return Region.IsValid() || FFileHelper::LoadFileToArray(FallbackData, *Filename, FILEREAD_Silent);
+		}
+
+		const uint8* GetData() const { return Region ? Region->GetMappedPtr() : FallbackData.GetData(); }
+		int64 GetSize() const { return Region ? Region->GetMappedSize() : FallbackData.Num(); }
+	};
+
+	// Create a config referencing external font data, which are kept alive by the given owner for as long as the config
+	// is referenced (font atlas builds hold references to configs they use).
+	template<typename TOwner>
+	TSharedPtr<ImFontConfig> MakeFontConfig(const ImFontConfig& FontConfig, const uint8* Data, int64 Size, TOwner Owner)
+	{
+		ImFontConfig* Config = new ImFontConfig(FontConfig);
+
+		// Atlas only reads font data, so we can hand it a read-only view. Data are referenced by the atlas, without
+		// making a copy (see ImFontConfig::FontDataReferenced).
+		Config->FontData = const_cast<uint8*>(Data);
+		Config->FontDataSize = static_cast<int>(Size);
+		Config->FontDataOwnedByAtlas = false;
+		Config->FontDataReferenced = true;
+
+		return MakeShareable(Config, [Owner](ImFontConfig* Obj) { delete Obj; });
+	}
+}
+
+void FImGuiModuleProperties::SetInputEnabled(bool bEnabled)
+{
+	if (bEnabled)
+	{
+		FImGuiModuleManager::RequestActivation(TEXT("input mode enabled"));
+	}
+	bInputEnabled = bEnabled;
+}
+
+void FImGuiModuleProperties::SetShowDemo(bool bShow)
+{
+	if (bShow)
+	{
+		FImGuiModuleManager::RequestActivation(TEXT("demo shown"));
+	}
+	bShowDemo = bShow;
+}
+
+void FImGuiModuleProperties::SetShowLog(bool bShow)
+{
+	if (bShow)
+	{
+		FImGuiModuleManager::RequestActivation(TEXT("log window shown"));
+	}
+	bShowLog = bShow;
+}
+
+bool FImGuiModuleProperties::AddCustomFontFromFile(FName FontName, const FString& Filename, const ImFontConfig& FontConfig)
+{
+	TSharedPtr<FMappedFontFile> FontFile = MakeShared<FMappedFontFile>();
+	if (!FontFile->Open(Filename) || FontFile->GetSize() <= 0 || FontFile->GetSize() > MAX_int32)
+	{
+		UE_LOG(LogImGuiFonts, Warning, TEXT("Couldn't open font file '%s' for custom font '%s'."), *Filename, *FontName.ToString());
+		return false;
+	}
+
+	AddCustomFont(FontName, MakeFontConfig(FontConfig, FontFile->GetData(), FontFile->GetSize(), FontFile));
+	return true;
+}
+
+bool FImGuiModuleProperties::AddCustomFontFromFontFace(FName FontName, const UFontFace* FontFace, const ImFontConfig& FontConfig)
+{
+	if (!FontFace)
+	{
+		return false;
+	}
+
+	if (FontFace->GetLoadingPolicy() == EFontLoadingPolicy::Inline)
+	{
+		FFontFaceDataConstRef FontFaceData = FontFace->GetFontFaceData();
+		if (!FontFaceData->HasData() || FontFaceData->GetData().Num() <= 0)
+		{
+			UE_LOG(LogImGuiFonts, Warning, TEXT("Font face '%s' for custom font '%s' has no data."), *FontFace->GetName(), *FontName.ToString());
+			return false;
+		}
+
+		const TArray<uint8>& Data = FontFaceData->GetData();
+		AddCustomFont(FontName, MakeFontConfig(FontConfig, Data.GetData(), Data.Num(), FontFaceData));
+		return true;
+	}
+
+	return AddCustomFontFromFile(FontName, FontFace->GetFontFilename(), FontConfig);
+}
@@ -122,12 +122,16 @@ void FImGuiModuleSettings::UpdateSettings()
 	if (UImGuiSettings* SettingsObject = UImGuiSettings::Get())
 	{
 		SetImGuiInputHandlerClass(SettingsObject->ImGuiInputHandlerClass);
+		SetLazyStartup(SettingsObject->bLazyStartup);
 		SetShareKeyboardInput(SettingsObject->bShareKeyboardInput);
 		SetShareGamepadInput(SettingsObject->bShareGamepadInput);
 		SetShareMouseInput(SettingsObject->bShareMouseInput);
 		SetUseSoftwareCursor(SettingsObject->bUseSoftwareCursor);
 		SetToggleInputKey(SettingsObject->ToggleInput);
 		SetCanvasSizeInfo(SettingsObject->CanvasSize);
+		SetRasterizeGlyphsOnDemand(SettingsObject->bRasterizeGlyphsOnDemand);
+		SetCacheFontAtlas(SettingsObject->bCacheFontAtlas);
+		SetFontAtlasTextureFormat(SettingsObject->FontAtlasTextureFormat);
 	}
 }
 
@@ -148,6 +152,15 @@ void FImGuiModuleSettings::SetImGuiInputHandlerClass(const FSoftClassPath& Class
 	}
 }
 
+void FImGuiModuleSettings::SetLazyStartup(bool bLazy)
+{
+	if (bLazyStartup != bLazy)
+	{
+		bLazyStartup = bLazy;
+		OnLazyStartupChanged.Broadcast(bLazy);
+	}
+}
+
 void FImGuiModuleSettings::SetShareKeyboardInput(bool bShare)
 {
 	if (bShareKeyboardInput != bShare)
@@ -202,6 +215,30 @@ void FImGuiModuleSettings::SetCanvasSizeInfo(const FImGuiCanvasSizeInfo& CanvasS
 	}
 }
 
+void FImGuiModuleSettings::SetRasterizeGlyphsOnDemand(bool bRasterizeOnDemand)
+{
+	if (bRasterizeGlyphsOnDemand != bRasterizeOnDemand)
+	{
+		bRasterizeGlyphsOnDemand = bRasterizeOnDemand;
+		OnRasterizeGlyphsOnDemandChanged.Broadcast(bRasterizeOnDemand);
+	}
+}
+
+void FImGuiModuleSettings::SetCacheFontAtlas(bool bCache)
+{
+	// Only affects subsequent atlas builds, so there is no need to broadcast changes.
+	bCacheFontAtlas = bCache;
+}
+
+void FImGuiModuleSettings::SetFontAtlasTextureFormat(EImGuiFontAtlasTextureFormat Format)
+{
+	if (FontAtlasTextureFormat != Format)
+	{
+		FontAtlasTextureFormat = Format;
+		OnFontAtlasTextureFormatChanged.Broadcast(Format);
+	}
+}
+
 void FImGuiModuleSettings::SetDPIScaleInfo(const FImGuiDPIScaleInfo& ScaleInfo)
 {
 	DPIScale = ScaleInfo;
@@ -108,6 +108,13 @@ enum class EImGuiDPIScaleMethod : uint8
 	Slate UMETA(ToolTip = "Scale in Slate. ImGui canvas size will be adjusted to get the screen size that is the same as defined in the Canvas Size property.")
 };
 
+UENUM(BlueprintType)
+enum class EImGuiFontAtlasTextureFormat : uint8
+{
+	RGBA UMETA(DisplayName = "RGBA", ToolTip = "Uncompressed 32-bit texture (4 bytes per pixel)."),
+	Compressed UMETA(ToolTip = "Block-compressed texture with glyph coverage in the alpha channel (1 byte per pixel). Falls back to RGBA, if not supported by the platform.")
+};
+
 /**
  * Struct with DPI scale data.
  */
@@ -178,6 +185,12 @@ protected:
 	UPROPERTY(EditAnywhere, config, Category = "Extensions", meta = (MetaClass = "/Script/ImGui.ImGuiInputHandler"))
 	FSoftClassPath ImGuiInputHandlerClass;
 
+	// If enabled, the module doesn't build fonts, create textures or add widgets to viewports until it is used for the
+	// first time: when a draw delegate is bound, input mode is toggled or demo is shown. Duration of each startup step
+	// is reported in the log. In builds where settings are loaded after the module, this takes effect after restart.
+	UPROPERTY(EditAnywhere, config, Category = "Extensions")
+	bool bLazyStartup = false;
+
 	// Whether ImGui should share keyboard input with game.
 	// This defines initial behaviour which can be later changed using 'ImGui.ToggleKeyboardInputSharing' command or
 	// module properties interface.
@@ -218,6 +231,24 @@ protected:
 	UPROPERTY(EditAnywhere, config, Category = "DPI Scale", Meta = (ShowOnlyInnerProperties))
 	FImGuiDPIScaleInfo DPIScale;
 
+	// If enabled, glyphs of custom fonts are rasterized on demand. Font atlas starts only with Basic Latin glyphs and
+	// glyphs requested by text rendering are added in batches, what keeps the atlas small for fonts with large glyph
+	// ranges (e.g. CJK). Missing glyphs are drawn with a fallback character until the atlas is rebuilt.
+	UPROPERTY(EditAnywhere, config, Category = "Font Atlas")
+	bool bRasterizeGlyphsOnDemand = false;
+
+	// If enabled, built font atlases are cached in the Saved/ImGui/FontAtlasCache directory and loaded during subsequent
+	// launches, as long as fonts and their configuration don't change. Only a few most recently used atlases are kept.
+	// Atlases in the project's Content/ImGui/FontAtlasCache directory are also used and staged with packaged builds.
+	UPROPERTY(EditAnywhere, config, Category = "Font Atlas")
+	bool bCacheFontAtlas = false;
+
+	// Format of the font atlas texture. Glyphs only need coverage, so the compressed format stores it in the alpha channel
+	// of a DXT5 texture with white color (alpha blocks have the same encoding as BC4). It uses four times less memory than
+	// RGBA, what matters for atlases with large fonts, at the cost of a slightly lower precision of anti-aliased edges.
+	UPROPERTY(EditAnywhere, config, Category = "Font Atlas")
+	EImGuiFontAtlasTextureFormat FontAtlasTextureFormat = EImGuiFontAtlasTextureFormat::RGBA;
+
 	static UImGuiSettings* DefaultInstance;
 
 	friend class FImGuiModuleSettings;
@@ -239,6 +270,7 @@ public:
 	DECLARE_MULTICAST_DELEGATE_OneParam(FStringClassReferenceChangeDelegate, const FSoftClassPath&);
 	DECLARE_MULTICAST_DELEGATE_OneParam(FImGuiCanvasSizeInfoChangeDelegate, const FImGuiCanvasSizeInfo&);
 	DECLARE_MULTICAST_DELEGATE_OneParam(FImGuiDPIScaleInfoChangeDelegate, const FImGuiDPIScaleInfo&);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FImGuiFontAtlasTextureFormatChangeDelegate, EImGuiFontAtlasTextureFormat);
 
 	// Constructor for ImGui module settings. It will bind to instances of module properties and commands and will
 	// update them every time when settings are changed.
@@ -255,6 +287,9 @@ public:
 	// Get the path to custom implementation of ImGui Input Handler.
 	const FSoftClassPath& GetImGuiInputHandlerClass() const { return ImGuiInputHandlerClass; }
 
+	// Get the lazy startup configuration.
+	bool LazyStartup() const { return bLazyStartup; }
+
 	// Get the software cursor configuration.
 	bool UseSoftwareCursor() const { return bUseSoftwareCursor; }
 
@@ -267,18 +302,36 @@ public:
 	// Get the DPI Scale information.
 	const FImGuiDPIScaleInfo& GetDPIScaleInfo() const { return DPIScale; }
 
+	// Get the on-demand glyph rasterization configuration.
+	bool RasterizeGlyphsOnDemand() const { return bRasterizeGlyphsOnDemand; }
+
+	// Get the font atlas cache configuration.
+	bool CacheFontAtlas() const { return bCacheFontAtlas; }
+
+	// Get the font atlas texture format.
+	EImGuiFontAtlasTextureFormat GetFontAtlasTextureFormat() const { return FontAtlasTextureFormat; }
+
 	// Delegate raised when ImGui Input Handle is changed.
 	FStringClassReferenceChangeDelegate OnImGuiInputHandlerClassChanged;
 
 	// Delegate raised when software cursor configuration is changed.
 	FBoolChangeDelegate OnUseSoftwareCursorChanged;
 
+	// Delegate raised when lazy startup configuration is changed.
+	FBoolChangeDelegate OnLazyStartupChanged;
+
 	// Delegate raised when information how to calculate the canvas size is changed.
 	FImGuiCanvasSizeInfoChangeDelegate OnCanvasSizeChangedDelegate;
 
 	// Delegate raised when the DPI scale is changed.
 	FImGuiDPIScaleInfoChangeDelegate OnDPIScaleChangedDelegate;
 
+	// Delegate raised when on-demand glyph rasterization configuration is changed.
+	FBoolChangeDelegate OnRasterizeGlyphsOnDemandChanged;
+
+	// Delegate raised when the font atlas texture format is changed.
+	FImGuiFontAtlasTextureFormatChangeDelegate OnFontAtlasTextureFormatChanged;
+
 private:
 
 	void InitializeAllSettings();
@@ -286,6 +339,7 @@ private:
 	void UpdateDPIScaleInfo();
 
 	void SetImGuiInputHandlerClass(const FSoftClassPath& ClassReference);
+	void SetLazyStartup(bool bLazy);
 	void SetShareKeyboardInput(bool bShare);
 	void SetShareGamepadInput(bool bShare);
 	void SetShareMouseInput(bool bShare);
@@ -293,6 +347,9 @@ private:
 	void SetToggleInputKey(const FImGuiKeyInfo& KeyInfo);
 	void SetCanvasSizeInfo(const FImGuiCanvasSizeInfo& CanvasSizeInfo);
 	void SetDPIScaleInfo(const FImGuiDPIScaleInfo& ScaleInfo);
+	void SetRasterizeGlyphsOnDemand(bool bRasterizeOnDemand);
+	void SetCacheFontAtlas(bool bCache);
+	void SetFontAtlasTextureFormat(EImGuiFontAtlasTextureFormat Format);
 
 #if WITH_EDITOR
 	void OnPropertyChanged(class UObject* ObjectBeingModified, struct FPropertyChangedEvent& PropertyChangedEvent);
@@ -309,4 +366,8 @@ private:
 	bool bShareGamepadInput = false;
 	bool bShareMouseInput = false;
 	bool bUseSoftwareCursor = false;
+	bool bLazyStartup = false;
+	bool bRasterizeGlyphsOnDemand = false;
+	bool bCacheFontAtlas = false;
+	EImGuiFontAtlasTextureFormat FontAtlasTextureFormat = EImGuiFontAtlasTextureFormat::RGBA;
 };
@@ -0,0 +1,190 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiTextCache.h"
+
+#include <Hash/xxhash.h>
+
+#include <imgui_internal.h>
+
+
+namespace
+{
+	// Limits of entries kept between frames.
+	constexpr int32 MaxTextSizes = 2048;
+	constexpr int32 MaxWordWraps = 256;
+
+	// Shorter texts are measured faster than they are hashed and looked up.
+	constexpr int32 MinTextLength = 16;
+
+	uint64 HashText(const char* TextBegin, const char* TextEnd)
+	{
+		const int32 Length = static_cast<int32>(TextEnd - TextBegin);
+		return Length >= MinTextLength ? FXxHash64::HashBuffer(TextBegin, Length).Hash : 0;
+	}
+
+	FImGuiTextCache* GetCurrentCache()
+	{
+#ifdef IMGUI_TEXT_CACHE
+		const ImGuiContext* Context = ImGui::GetCurrentContext();
+		return Context ? static_cast<FImGuiTextCache*>(Context->TextCache) : nullptr;
+#else
+		return nullptr;
+#endif
+	}
+}
+
+bool FImGuiTextCache::FindTextSize(const ImFont* Font, float Size, float MaxWidth, float WrapWidth, const char* TextBegin,
+	const char* TextEnd, uint64& OutHash, ImVec2& OutSize, const char*& OutRemaining)
+{
+	OutHash = HashText(TextBegin, TextEnd);
+	if (OutHash)
+	{
+		const FTextKey Key{ Font, Size, MaxWidth, WrapWidth, OutHash, static_cast<int32>(TextEnd - TextBegin) };
+		if (FTextSizeEntry* Entry = TextSizes.Find(Key))
+		{
+			Entry->LastUsedFrame = Frame;
+			OutSize = Entry->Size;
+			OutRemaining = TextBegin + Entry->RemainingOffset;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FImGuiTextCache::AddTextSize(uint64 Hash, const ImFont* Font, float Size, float MaxWidth, float WrapWidth,
+	const char* TextBegin, const char* TextEnd, const ImVec2& TextSize, const char* Remaining)
+{
+	if (Hash)
+	{
+		const FTextKey Key{ Font, Size, MaxWidth, WrapWidth, Hash, static_cast<int32>(TextEnd - TextBegin) };
+		TextSizes.Add(Key, { TextSize, static_cast<int32>(Remaining - TextBegin), Frame });
+	}
+}
+
+void* FImGuiTextCache::FindWordWrap(const ImFont* Font, float Scale, float WrapWidth, const char* TextBegin, const char* TextEnd)
+{
+	const uint64 Hash = HashText(TextBegin, TextEnd);
+	if (!Hash)
+	{
+		return nullptr;
+	}
+
+	const FTextKey Key{ Font, Scale, 0.f, WrapWidth, Hash, static_cast<int32>(TextEnd - TextBegin) };
+	TUniquePtr<FWordWrapEntry>& Entry = WordWraps.FindOrAdd(Key);
+	if (!Entry)
+	{
+		Entry = MakeUnique<FWordWrapEntry>();
+		Entry->WrapWidth = WrapWidth;
+	}
+
+	Entry->LastUsedFrame = Frame;
+	return Entry.Get();
+}
+
+const char* FImGuiTextCache::CalcWordWrapPosition(void* WordWrap, const ImFont* Font, float Scale, float WrapWidth,
+	const char* TextBegin, const char* Text, const char* TextEnd)
+{
+	FWordWrapEntry& Entry = *static_cast<FWordWrapEntry*>(WordWrap);
+	if (WrapWidth != Entry.WrapWidth)
+	{
+		// Lines are wrapped at full width, so this is not expected, but different widths shouldn't share positions.
+		return Font->CalcWordWrapPositionA(Scale, Text, TextEnd, WrapWidth);
+	}
+
+	const int32 LineBegin = static_cast<int32>(Text - TextBegin);
+
+	if (const int32* LineEnd = Entry.LineEnds.Find(LineBegin))
+	{
+		return TextBegin + *LineEnd;
+	}
+
+	const char* Position = Font->CalcWordWrapPositionA(Scale, Text, TextEnd, WrapWidth);
+	Entry.LineEnds.Add(LineBegin, static_cast<int32>(Position - TextBegin));
+	return Position;
+}
+
+void FImGuiTextCache::Clear()
+{
+	TextSizes.Reset();
+	WordWraps.Reset();
+}
+
+void FImGuiTextCache::Tick()
+{
+	Frame++;
+
+	Evict(TextSizes, MaxTextSizes);
+	Evict(WordWraps, MaxWordWraps);
+}
+
+template<typename TMapType>
+void FImGuiTextCache::Evict(TMapType& Entries, int32 MaxEntries)
+{
+	if (Entries.Num() <= MaxEntries)
+	{
+		return;
+	}
+
+	// Evict down to three quarters of the limit, so eviction doesn't run every frame while the cache is full.
+	TArray<uint32> LastUsedFrames;
+	LastUsedFrames.Reserve(Entries.Num());
+	for (const auto& Pair : Entries)
+	{
+		LastUsedFrames.Add(GetLastUsedFrame(Pair.Value));
+	}
+	LastUsedFrames.Sort();
+
+	const uint32 Threshold = LastUsedFrames[Entries.Num() - MaxEntries * 3 / 4];
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (GetLastUsedFrame(It.Value()) < Threshold)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+namespace ImGuiTextCache
+{
+	void SetContextCache(ImGuiContext* Context, FImGuiTextCache* Cache)
+	{
+#ifdef IMGUI_TEXT_CACHE
+		if (Context)
+		{
+			Context->TextCache = Cache;
+		}
+#endif
+	}
+
+	bool FindTextSize(const ImFont* Font, float Size, float MaxWidth, float WrapWidth, const char* TextBegin,
+		const char* TextEnd, unsigned long long* OutHash, ImVec2* OutSize, const char** OutRemaining)
+	{
+		uint64 Hash = 0;
+		FImGuiTextCache* Cache = GetCurrentCache();
+		const bool bFound = Cache && Cache->FindTextSize(Font, Size, MaxWidth, WrapWidth, TextBegin, TextEnd, Hash, *OutSize, *OutRemaining);
+		*OutHash = Hash;
+		return bFound;
+	}
+
+	void AddTextSize(unsigned long long Hash, const ImFont* Font, float Size, float MaxWidth, float WrapWidth,
+		const char* TextBegin, const char* TextEnd, const ImVec2& TextSize, const char* Remaining)
+	{
+		if (FImGuiTextCache* Cache = GetCurrentCache())
+		{
+			Cache->AddTextSize(Hash, Font, Size, MaxWidth, WrapWidth, TextBegin, TextEnd, TextSize, Remaining);
+		}
+	}
+
+	void* FindWordWrap(const ImFont* Font, float Scale, float WrapWidth, const char* TextBegin, const char* TextEnd)
+	{
+		FImGuiTextCache* Cache = GetCurrentCache();
+		return Cache ? Cache->FindWordWrap(Font, Scale, WrapWidth, TextBegin, TextEnd) : nullptr;
+	}
+
+	const char* CalcWordWrapPosition(void* WordWrap, const ImFont* Font, float Scale, float WrapWidth,
+		const char* TextBegin, const char* Text, const char* TextEnd)
+	{
+		return FImGuiTextCache::CalcWordWrapPosition(WordWrap, Font, Scale, WrapWidth, TextBegin, Text, TextEnd);
+	}
+}
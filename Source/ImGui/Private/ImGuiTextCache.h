@@ -0,0 +1,115 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <Containers/Map.h>
+#include <Templates/UniquePtr.h>
+
+#include <imgui.h>
+
+
+// Caches text measurements and word wrap positions of a single context, so repeated strings (labels, wrapped
+// paragraphs, tooltips) are measured only once. Entries are keyed by text hash, font, size and wrap width and the least
+// recently used ones are evicted when the cache grows over its limits. Results depend on font metrics, so the cache
+// needs to be cleared whenever font atlases are rebuilt.
+class FImGuiTextCache
+{
+public:
+
+	FImGuiTextCache() = default;
+
+	FImGuiTextCache(const FImGuiTextCache&) = delete;
+	FImGuiTextCache& operator=(const FImGuiTextCache&) = delete;
+
+	FImGuiTextCache(FImGuiTextCache&&) = delete;
+	FImGuiTextCache& operator=(FImGuiTextCache&&) = delete;
+
+	// Find a cached text size. If text can be cached but is not found, the returned hash should be passed when adding it.
+	// @returns True, if size and remaining text were found in the cache
+	bool FindTextSize(const ImFont* Font, float Size, float MaxWidth, float WrapWidth, const char* TextBegin,
+		const char* TextEnd, uint64& OutHash, ImVec2& OutSize, const char*& OutRemaining);
+
+	// Add a measured text size. Does nothing if hash is zero (text that is not cached).
+	void AddTextSize(uint64 Hash, const ImFont* Font, float Size, float MaxWidth, float WrapWidth, const char* TextBegin,
+		const char* TextEnd, const ImVec2& TextSize, const char* Remaining);
+
+	// Find or create word wrap positions of a text. Positions are filled in as text is wrapped, so entry is valid
+	// until the next frame.
+	// @returns Word wrap positions or null, if text is not cached
+	void* FindWordWrap(const ImFont* Font, float Scale, float WrapWidth, const char* TextBegin, const char* TextEnd);
+
+	// Get the word wrap position for a line starting at the given text, using cached position if possible.
+	static const char* CalcWordWrapPosition(void* WordWrap, const ImFont* Font, float Scale, float WrapWidth,
+		const char* TextBegin, const char* Text, const char* TextEnd);
+
+	// Remove all entries.
+	void Clear();
+
+	// Advance to the next frame, evicting least recently used entries if the cache is over its limits.
+	void Tick();
+
+private:
+
+	struct FTextKey
+	{
+		const ImFont* Font = nullptr;
+		float Size = 0.f;
+		float MaxWidth = 0.f;
+		float WrapWidth = 0.f;
+		uint64 Hash = 0;
+		int32 Length = 0;
+
+		bool operator==(const FTextKey& Other) const
+		{
+			return Hash == Other.Hash && Length == Other.Length && Font == Other.Font && Size == Other.Size
+				&& MaxWidth == Other.MaxWidth && WrapWidth == Other.WrapWidth;
+		}
+
+		friend uint32 GetTypeHash(const FTextKey& Key)
+		{
+			return HashCombine(::GetTypeHash(Key.Hash), HashCombine(::GetTypeHash(Key.Font),
+				HashCombine(::GetTypeHash(Key.Size), ::GetTypeHash(Key.WrapWidth))));
+		}
+	};
+
+	struct FTextSizeEntry
+	{
+		ImVec2 Size;
+		int32 RemainingOffset = 0;
+		uint32 LastUsedFrame = 0;
+	};
+
+	struct FWordWrapEntry
+	{
+		// Offsets of wrap positions, by offsets of line beginnings.
+		TMap<int32, int32> LineEnds;
+		float WrapWidth = 0.f;
+		uint32 LastUsedFrame = 0;
+	};
+
+	static uint32 GetLastUsedFrame(const FTextSizeEntry& Entry) { return Entry.LastUsedFrame; }
+	static uint32 GetLastUsedFrame(const TUniquePtr<FWordWrapEntry>& Entry) { return Entry->LastUsedFrame; }
+
+	template<typename TMapType>
+	static void Evict(TMapType& Entries, int32 MaxEntries);
+
+	TMap<FTextKey, FTextSizeEntry> TextSizes;
+	TMap<FTextKey, TUniquePtr<FWordWrapEntry>> WordWraps;
+
+	uint32 Frame = 0;
+};
+
+namespace ImGuiTextCache
+{
+	// Bind a text cache to a context, or unbind it with null. Cache needs to outlive the binding.
+	void SetContextCache(ImGuiContext* Context, FImGuiTextCache* Cache);
+
+	// Entry points for IMGUI_TEXT_CACHE hooks (see imconfig.h). Forward calls to the text cache of the current context.
+	bool FindTextSize(const ImFont* Font, float Size, float MaxWidth, float WrapWidth, const char* TextBegin,
+		const char* TextEnd, unsigned long long* OutHash, ImVec2* OutSize, const char** OutRemaining);
+	void AddTextSize(unsigned long long Hash, const ImFont* Font, float Size, float MaxWidth, float WrapWidth,
+		const char* TextBegin, const char* TextEnd, const ImVec2& TextSize, const char* Remaining);
+	void* FindWordWrap(const ImFont* Font, float Scale, float WrapWidth, const char* TextBegin, const char* TextEnd);
+	const char* CalcWordWrapPosition(void* WordWrap, const ImFont* Font, float Scale, float WrapWidth,
+		const char* TextBegin, const char* Text, const char* TextEnd);
+}
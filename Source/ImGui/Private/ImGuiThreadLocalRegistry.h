@@ -0,0 +1,137 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiModuleManager.h"
+
+#include <atomic>
+
+
+// Registry of per-thread instances of T, used by queues that pass data from any thread to the game thread. Each thread
+// gets its own instance on the first use, which is added to a lock-free list, so the game thread can visit instances of
+// all threads. Instances of finished threads are reused by new threads and all instances are deleted with the registry
+// or, if their threads still use them at that point, when those threads finish.
+//
+// The calling thread's instance is cached in a thread-local variable shared by all registries of T, so there should be
+// only one registry per type.
+template<typename T>
+class TImGuiThreadLocalRegistry
+{
+public:
+
+	TImGuiThreadLocalRegistry() = default;
+
+	~TImGuiThreadLocalRegistry()
+	{
+		FEntry* Entry = Entries.exchange(nullptr, std::memory_order_acquire);
+		while (Entry)
+		{
+			FEntry* Next = Entry->Next;
+
+			// Instances still used by their threads are deleted when those threads finish.
+			if (Entry->State.exchange(Orphaned, std::memory_order_acq_rel) == Released)
+			{
+				delete Entry;
+			}
+
+			Entry = Next;
+		}
+	}
+
+	TImGuiThreadLocalRegistry(const TImGuiThreadLocalRegistry&) = delete;
+	TImGuiThreadLocalRegistry& operator=(const TImGuiThreadLocalRegistry&) = delete;
+
+	TImGuiThreadLocalRegistry(TImGuiThreadLocalRegistry&&) = delete;
+	TImGuiThreadLocalRegistry& operator=(TImGuiThreadLocalRegistry&&) = delete;
+
+	// Get the instance of the calling thread.
+	T& GetThreadInstance()
+	{
+		if (!ThreadHandle.Entry)
+		{
+			// Take over the instance of a finished thread, if there is one.
+			for (FEntry* Entry = Entries.load(std::memory_order_acquire); Entry; Entry = Entry->Next)
+			{
+				uint8 Expected = Released;
+				if (Entry->State.compare_exchange_strong(Expected, InUse, std::memory_order_acquire))
+				{
+					ThreadHandle.Entry = Entry;
+					return Entry->Value;
+				}
+			}
+
+			FEntry* Entry = new FEntry();
+			Entry->Next = Entries.load(std::memory_order_relaxed);
+			while (!Entries.compare_exchange_weak(Entry->Next, Entry, std::memory_order_release, std::memory_order_relaxed))
+			{
+			}
+
+			ThreadHandle.Entry = Entry;
+		}
+
+		return ThreadHandle.Entry->Value;
+	}
+
+	// Call a function for instances of all threads, including finished ones. Instances can be added concurrently, but
+	// they are not removed before the registry is destroyed.
+	template<typename FunctorType>
+	void ForEach(FunctorType&& Func)
+	{
+		for (FEntry* Entry = Entries.load(std::memory_order_acquire); Entry; Entry = Entry->Next)
+		{
+			Func(Entry->Value);
+		}
+	}
+
+	// Request activation of the module manager, the first time this is called. Can be called from any thread. Like
+	// FImGuiModuleManager::RequestDrawActivation, it doesn't activate runtime lite builds.
+	// @param Reason - Description of what caused the activation, which needs to outlive the request (e.g. a literal)
+	void RequestActivation(const TCHAR* Reason)
+	{
+		if (!IMGUI_RUNTIME_LITE && !bActivationRequested.load(std::memory_order_relaxed) && !bActivationRequested.exchange(true))
+		{
+			FImGuiModuleManager::RequestActivationOnGameThread(Reason);
+		}
+	}
+
+private:
+
+	enum EState : uint8
+	{
+		InUse,
+		Released,
+		// The registry was destroyed while the instance was in use, so the owning thread deletes it.
+		Orphaned,
+	};
+
+	struct FEntry
+	{
+		T Value;
+
+		// One of EState values.
+		std::atomic<uint8> State{ InUse };
+
+		FEntry* Next = nullptr;
+	};
+
+	// Releases the instance of a thread when that thread finishes, so it can be reused by other threads.
+	struct FThreadHandle
+	{
+		~FThreadHandle()
+		{
+			if (Entry && Entry->State.exchange(Released, std::memory_order_acq_rel) == Orphaned)
+			{
+				delete Entry;
+			}
+		}
+
+		FEntry* Entry = nullptr;
+	};
+
+	static inline thread_local FThreadHandle ThreadHandle;
+
+	// All instances. Instances are only added and deleted with the registry.
+	std::atomic<FEntry*> Entries{ nullptr };
+
+	std::atomic<bool> bActivationRequested{ false };
+};
@@ -0,0 +1,140 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include <Math/RandomStream.h>
+#include <Misc/AutomationTest.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// SSE matches the scalar code exactly, while NEON refines its reciprocal square root estimate and only matches it
+	// within float precision. Miters are scaled by up to IM_FIXNORMAL2F_MAX_INVLEN2, so they use a relative tolerance.
+	constexpr float NormalTolerance = 1.e-5f;
+
+	bool IsNearlyEqual(const ImVec2& A, const ImVec2& B, float Tolerance)
+	{
+		const float Scale = FMath::Max3(1.f, FMath::Abs(B.x), FMath::Abs(B.y));
+		return FMath::IsNearlyEqual(A.x, B.x, Tolerance * Scale) && FMath::IsNearlyEqual(A.y, B.y, Tolerance * Scale);
+	}
+
+	enum class EPolylineShape : uint8
+	{
+		// Random points.
+		Random,
+		// Random points with repeated points, which give zero-length segments.
+		Repeated,
+		// All points in the same position.
+		Collapsed,
+		// Points going back and forth on a line, which give opposite normals and zero-length miters.
+		Reversing,
+	};
+
+	TArray<ImVec2> MakePoints(int32 NumPoints, EPolylineShape Shape, FRandomStream& Random)
+	{
+		TArray<ImVec2> Points;
+		Points.SetNumUninitialized(NumPoints);
+		for (int32 Index = 0; Index < NumPoints; Index++)
+		{
+			switch (Shape)
+			{
+			case EPolylineShape::Random:
+				Points[Index] = ImVec2(Random.FRandRange(-500.f, 500.f), Random.FRandRange(-500.f, 500.f));
+				break;
+			case EPolylineShape::Repeated:
+				Points[Index] = (Index > 0 && Random.RandRange(0, 2) == 0) ? Points[Index - 1]
+					: ImVec2(Random.FRandRange(-500.f, 500.f), Random.FRandRange(-500.f, 500.f));
+				break;
+			case EPolylineShape::Collapsed:
+				Points[Index] = ImVec2(10.f, 20.f);
+				break;
+			case EPolylineShape::Reversing:
+				Points[Index] = ImVec2((Index % 2) ? 100.f : 0.f, 50.f);
+				break;
+			}
+		}
+		return Points;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FImGuiDrawNormalsTest, "ImGui.Draw.PolylineNormals",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FImGuiDrawNormalsTest::RunTest(const FString& Parameters)
+{
+#if defined(IMGUI_ENABLE_SSE)
+	AddInfo(TEXT("Comparing SSE normals with scalar normals."));
+#elif defined(IMGUI_ENABLE_NEON)
+	AddInfo(TEXT("Comparing NEON normals with scalar normals."));
+#else
+	AddInfo(TEXT("SIMD is disabled, so normals are computed by the scalar code."));
+#endif
+
+	FRandomStream Random(1234);
+
+	const EPolylineShape Shapes[] = { EPolylineShape::Random, EPolylineShape::Repeated, EPolylineShape::Collapsed, EPolylineShape::Reversing };
+	for (const EPolylineShape Shape : Shapes)
+	{
+		// Even and odd numbers of points cover the scalar tail after pairs of vectorized points.
+		for (int32 NumPoints = 2; NumPoints <= 33; NumPoints++)
+		{
+			const TArray<ImVec2> Points = MakePoints(NumPoints, Shape, Random);
+
+			for (const bool bClosed : { false, true })
+			{
+				// Like in AddPolyline, open polylines have one segment less and their first point has no miter.
+				const int32 NumSegments = bClosed ? NumPoints : NumPoints - 1;
+				const int32 FirstMiter = bClosed ? 0 : 1;
+
+				TArray<ImVec2> Normals, ScalarNormals;
+				Normals.SetNumZeroed(NumPoints);
+				ScalarNormals.SetNumZeroed(NumPoints);
+
+				ImDrawListComputeSegmentNormals(Points.GetData(), NumPoints, NumSegments, Normals.GetData());
+				ImDrawListComputeSegmentNormalsScalar(Points.GetData(), NumPoints, 0, NumSegments, ScalarNormals.GetData());
+
+				for (int32 Index = 0; Index < NumSegments; Index++)
+				{
+					if (!IsNearlyEqual(Normals[Index], ScalarNormals[Index], NormalTolerance))
+					{
+						AddError(FString::Printf(TEXT("Segment normal %d of %d (shape %d, closed %d) is (%f, %f), expected (%f, %f)."),
+							Index, NumPoints, static_cast<int32>(Shape), bClosed, Normals[Index].x, Normals[Index].y,
+							ScalarNormals[Index].x, ScalarNormals[Index].y));
+						return false;
+					}
+				}
+
+				if (!bClosed)
+				{
+					ScalarNormals[NumPoints - 1] = ScalarNormals[NumPoints - 2];
+				}
+
+				// Both versions get the same normals, so differences come only from computing miters.
+				TArray<ImVec2> Miters, ScalarMiters;
+				Miters.SetNumZeroed(NumPoints);
+				ScalarMiters.SetNumZeroed(NumPoints);
+
+				ImDrawListComputeMiterNormals(ScalarNormals.GetData(), NumPoints, FirstMiter, Miters.GetData());
+				ImDrawListComputeMiterNormalsScalar(ScalarNormals.GetData(), NumPoints, FirstMiter, NumPoints, ScalarMiters.GetData());
+
+				for (int32 Index = FirstMiter; Index < NumPoints; Index++)
+				{
+					if (!IsNearlyEqual(Miters[Index], ScalarMiters[Index], NormalTolerance))
+					{
+						AddError(FString::Printf(TEXT("Miter %d of %d (shape %d, closed %d) is (%f, %f), expected (%f, %f)."),
+							Index, NumPoints, static_cast<int32>(Shape), bClosed, Miters[Index].x, Miters[Index].y,
+							ScalarMiters[Index].x, ScalarMiters[Index].y));
+						return false;
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
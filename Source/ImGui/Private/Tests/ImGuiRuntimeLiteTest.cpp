@@ -0,0 +1,102 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiDebugDraw.h"
+#include "ImGuiDeferredCommands.h"
+#include "ImGuiDelegates.h"
+#include "ImGuiModule.h"
+#include "ImGuiModuleManager.h"
+
+#include <Misc/AutomationTest.h>
+
+
+#if WITH_DEV_AUTOMATION_TESTS && IMGUI_RUNTIME_LITE
+
+extern FImGuiModuleManager* ImGuiModuleManager;
+
+// Delegates bound by the runtime lite test, removed after the test checks the module.
+struct FImGuiRuntimeLiteTestDelegates
+{
+	FDelegateHandle WorldDebug;
+	FDelegateHandle MultiContextDebug;
+#if IMGUI_WITH_OBSOLETE_DELEGATES
+	FImGuiDelegateHandle ModuleWorldDebug;
+	FImGuiDelegateHandle ModuleMultiContextDebug;
+#endif
+
+	void Remove()
+	{
+		FImGuiDelegates::OnWorldDebug().Remove(WorldDebug);
+		FImGuiDelegates::OnMultiContextDebug().Remove(MultiContextDebug);
+#if IMGUI_WITH_OBSOLETE_DELEGATES
+		FImGuiModule::Get().RemoveImGuiDelegate(ModuleWorldDebug);
+		FImGuiModule::Get().RemoveImGuiDelegate(ModuleMultiContextDebug);
+#endif
+	}
+};
+
+// Checks, after a number of frames, that the module is still inactive, which means that it doesn't tick, update
+// contexts or draw widgets.
+DEFINE_LATENT_AUTOMATION_COMMAND_THREE_PARAMETER(FImGuiCheckInactiveCommand, FAutomationTestBase*, Test, uint64, EndFrame,
+	TSharedRef<FImGuiRuntimeLiteTestDelegates>, Delegates);
+
+bool FImGuiCheckInactiveCommand::Update()
+{
+	// Activation requested by worker threads happens in game thread tasks, so it takes a few frames to show.
+	if (GFrameCounter < EndFrame)
+	{
+		return false;
+	}
+
+	Test->TestFalse(TEXT("Module is active after draw delegates were bound and draw commands submitted"),
+		ImGuiModuleManager && ImGuiModuleManager->IsActive());
+
+	Delegates->Remove();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FImGuiRuntimeLiteInactiveTest, "ImGui.RuntimeLite.NoPerFrameCost",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FImGuiRuntimeLiteInactiveTest::RunTest(const FString& Parameters)
+{
+	if (!ImGuiModuleManager)
+	{
+		AddError(TEXT("ImGui module is not loaded."));
+		return false;
+	}
+
+	if (ImGuiModuleManager->IsActive())
+	{
+		AddWarning(TEXT("ImGui module was activated by explicit use (input mode, demo or log window) before the test."));
+		return true;
+	}
+
+	// Use every way of drawing, without explicitly using the module.
+	TSharedRef<FImGuiRuntimeLiteTestDelegates> Delegates = MakeShared<FImGuiRuntimeLiteTestDelegates>();
+	Delegates->WorldDebug = FImGuiDelegates::OnWorldDebug().AddLambda([]() {});
+	Delegates->MultiContextDebug = FImGuiDelegates::OnMultiContextDebug().AddLambda([]() {});
+#if IMGUI_WITH_OBSOLETE_DELEGATES
+	Delegates->ModuleWorldDebug = FImGuiModule::Get().AddWorldImGuiDelegate(FImGuiDelegate::CreateLambda([]() {}));
+	Delegates->ModuleMultiContextDebug = FImGuiModule::Get().AddMultiContextImGuiDelegate(FImGuiDelegate::CreateLambda([]() {}));
+#endif
+
+	FImGuiDebugDraw::ScreenLine(nullptr, FVector2D::ZeroVector, FVector2D::UnitVector, FColor::White);
+	{
+		FImGuiDeferredCommands Commands;
+		Commands.Text("Runtime lite test");
+	}
+
+	TestFalse(TEXT("Module is active after draw delegates were bound"), ImGuiModuleManager->IsActive());
+
+#if !IMGUI_WITH_DELEGATES
+	// Bindings of disabled delegates are never called, so they shouldn't be kept.
+	FSimpleMulticastDelegate& DisabledDelegate = FImGuiDelegates::OnWorldDebug();
+	DisabledDelegate.AddLambda([]() {});
+	TestFalse(TEXT("Disabled delegate keeps bindings"), FImGuiDelegates::OnWorldDebug().IsBound());
+#endif
+
+	ADD_LATENT_AUTOMATION_COMMAND(FImGuiCheckInactiveCommand(this, GFrameCounter + 3, Delegates));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && IMGUI_RUNTIME_LITE
@@ -0,0 +1,127 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include <Containers/Map.h>
+#include <HAL/PlatformTime.h>
+#include <Misc/AutomationTest.h>
+
+#include <imgui.h>
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Number of times each key is looked up.
+	constexpr int32 LookupPasses = 4;
+
+	// Keys that look like ImGui IDs (hashed, in random order).
+	TArray<ImGuiID> MakeKeys(int32 NumKeys)
+	{
+		TArray<ImGuiID> Keys;
+		Keys.SetNumUninitialized(NumKeys);
+		for (int32 Index = 0; Index < NumKeys; Index++)
+		{
+			Keys[Index] = ImHashData(&Index, sizeof(Index), 0x5EED);
+		}
+		return Keys;
+	}
+}
+
+// Measures insertion and lookup in ImGuiStorage, which is used for tree node states and other per-ID data. Compare
+// results with and without IMGUI_STORAGE_OPEN_ADDRESSING (see imconfig.h). With sorted storage, insertion is O(N), so
+// inserting one million keys takes minutes.
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FImGuiStorageBenchmark, "ImGui.Benchmarks.Storage",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FImGuiStorageBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	OutBeautifiedNames.Add(TEXT("1k Keys"));
+	OutTestCommands.Add(TEXT("1000"));
+
+	OutBeautifiedNames.Add(TEXT("100k Keys"));
+	OutTestCommands.Add(TEXT("100000"));
+
+	OutBeautifiedNames.Add(TEXT("1M Keys"));
+	OutTestCommands.Add(TEXT("1000000"));
+}
+
+bool FImGuiStorageBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 NumKeys = FCString::Atoi(*Parameters);
+	if (NumKeys <= 0)
+	{
+		AddError(FString::Printf(TEXT("Invalid number of keys '%s'."), *Parameters));
+		return false;
+	}
+
+	const TArray<ImGuiID> Keys = MakeKeys(NumKeys);
+	ImGuiStorage Storage;
+
+	// Expected values. Hashes of different indices can collide, so later values replace earlier ones.
+	TMap<ImGuiID, int32> ExpectedValues;
+	ExpectedValues.Reserve(NumKeys);
+	for (int32 Index = 0; Index < NumKeys; Index++)
+	{
+		ExpectedValues.Add(Keys[Index], Index);
+	}
+
+	const double InsertStart = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumKeys; Index++)
+	{
+		Storage.SetInt(Keys[Index], Index);
+	}
+	const double InsertTime = FPlatformTime::Seconds() - InsertStart;
+
+	// Results are checked after timing, so checks don't affect it.
+	int64 Checksum = 0;
+	const double LookupStart = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < LookupPasses; Pass++)
+	{
+		for (int32 Index = 0; Index < NumKeys; Index++)
+		{
+			Checksum += Storage.GetInt(Keys[Index], -1);
+		}
+	}
+	const double LookupTime = FPlatformTime::Seconds() - LookupStart;
+
+	int64 ExpectedChecksum = 0;
+	int32 NumMismatches = 0;
+	for (int32 Index = 0; Index < NumKeys; Index++)
+	{
+		const int32 ExpectedValue = ExpectedValues.FindChecked(Keys[Index]);
+		ExpectedChecksum += ExpectedValue;
+
+		const int32 Value = Storage.GetInt(Keys[Index], -1);
+		if (Value != ExpectedValue && NumMismatches++ == 0)
+		{
+			AddError(FString::Printf(TEXT("Key %u has value %d, expected %d."), Keys[Index], Value, ExpectedValue));
+		}
+	}
+	TestEqual(TEXT("Number of keys with wrong values"), NumMismatches, 0);
+	TestEqual(TEXT("Sum of looked up values"), Checksum, ExpectedChecksum * LookupPasses);
+
+	// Keys that were never added should return the default value.
+	int32 NumFalsePositives = 0;
+	for (int32 Index = NumKeys; Index < NumKeys + FMath::Min(NumKeys, 1000); Index++)
+	{
+		const ImGuiID Key = ImHashData(&Index, sizeof(Index), 0x5EED);
+		if (!ExpectedValues.Contains(Key) && Storage.GetInt(Key, -1) != -1)
+		{
+			NumFalsePositives++;
+		}
+	}
+	TestEqual(TEXT("Number of missing keys with values"), NumFalsePositives, 0);
+
+#ifdef IMGUI_STORAGE_OPEN_ADDRESSING
+	const TCHAR* Implementation = TEXT("open addressing");
+#else
+	const TCHAR* Implementation = TEXT("sorted");
+#endif
+
+	AddInfo(FString::Printf(TEXT("ImGuiStorage (%s), %d keys: insertion %.3f ms, %d lookups per key %.3f ms."),
+		Implementation, NumKeys, InsertTime * 1000.0, LookupPasses, LookupTime * 1000.0));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
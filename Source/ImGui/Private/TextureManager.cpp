@@ -8,16 +8,68 @@
 #include <algorithm>
 
 
+namespace
+{
+	// Update a region of a texture with source data that have the same dimensions as the texture. For block-compressed
+	// formats, region is extended to block boundaries and source data are addressed in blocks.
+	void UpdateTextureRegion(UTexture2D* Texture, int32 Width, uint32 SrcBpp, uint8* SrcData, FIntRect Region, TFunction<void(uint8*)> SrcDataCleanup)
+	{
+		const FPixelFormatInfo& FormatInfo = GPixelFormats[Texture->GetPixelFormat()];
+		const int32 BlockSizeX = FormatInfo.BlockSizeX;
+		const int32 BlockSizeY = FormatInfo.BlockSizeY;
+
+		Region.Min.X = Region.Min.X / BlockSizeX * BlockSizeX;
+		Region.Min.Y = Region.Min.Y / BlockSizeY * BlockSizeY;
+		Region.Max.X = FMath::DivideAndRoundUp(Region.Max.X, BlockSizeX) * BlockSizeX;
+		Region.Max.Y = FMath::DivideAndRoundUp(Region.Max.Y, BlockSizeY) * BlockSizeY;
+
+		const uint32 SrcPitch = SrcBpp * FMath::DivideAndRoundUp(Width, BlockSizeX);
+
+		FUpdateTextureRegion2D* TextureRegion = new FUpdateTextureRegion2D(Region.Min.X, Region.Min.Y,
+			Region.Min.X / BlockSizeX, Region.Min.Y / BlockSizeY, Region.Width(), Region.Height());
+		auto DataCleanup = [SrcDataCleanup](uint8* Data, const FUpdateTextureRegion2D* UpdateRegion)
+		{
+			SrcDataCleanup(Data);
+			delete UpdateRegion;
+		};
+		Texture->UpdateTextureRegions(0, 1u, TextureRegion, SrcPitch, SrcBpp, SrcData, DataCleanup);
+	}
+}
+
 void FTextureManager::InitializeErrorTexture(const FColor& Color)
 {
 	CreatePlainTextureInternal(NAME_ErrorTexture, 2, 2, Color);
 }
 
-TextureIndex FTextureManager::CreateTexture(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup)
+TextureIndex FTextureManager::CreateTexture(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup, EPixelFormat PixelFormat)
 {
 	checkf(Name != NAME_None, TEXT("Trying to create a texture with a name 'NAME_None' is not allowed."));
 
-	return CreateTextureInternal(Name, Width, Height, SrcBpp, SrcData, SrcDataCleanup);
+	return CreateTextureInternal(Name, Width, Height, SrcBpp, SrcData, SrcDataCleanup, PixelFormat);
+}
+
+bool FTextureManager::UpdateTexture(TextureIndex Index, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, const FIntRect& Region, TFunction<void(uint8*)> SrcDataCleanup, EPixelFormat PixelFormat)
+{
+	// Only textures created by this manager are owned and can be updated.
+	UTexture2D* Texture = IsValidTexture(Index) ? Cast<UTexture2D>(TextureResources[Index].GetOwnedTexture()) : nullptr;
+	if (!Texture || Texture->GetSizeX() != Width || Texture->GetSizeY() != Height || Texture->GetPixelFormat() != PixelFormat)
+	{
+		return false;
+	}
+
+	checkf(Region.Min.X >= 0 && Region.Min.Y >= 0 && Region.Max.X <= Width && Region.Max.Y <= Height,
+		TEXT("Update region (%s) is outside of the %d x %d texture."), *Region.ToString(), Width, Height);
+
+	if (Region.IsEmpty())
+	{
+		SrcDataCleanup(SrcData);
+		return true;
+	}
+
+	// Update texture data. Source and destination share the same coordinates.
+	UpdateTextureRegion(Texture, Width, SrcBpp, SrcData, Region, SrcDataCleanup);
+
+	return true;
 }
 
 TextureIndex FTextureManager::CreatePlainTexture(const FName& Name, int32 Width, int32 Height, FColor Color)
@@ -43,22 +95,16 @@ void FTextureManager::ReleaseTextureResources(TextureIndex Index)
 	TextureResources[Index] = {};
 }
 
-TextureIndex FTextureManager::CreateTextureInternal(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup)
+TextureIndex FTextureManager::CreateTextureInternal(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup, EPixelFormat PixelFormat)
 {
 	// Create a texture.
-	UTexture2D* Texture = UTexture2D::CreateTransient(Width, Height);
+	UTexture2D* Texture = UTexture2D::CreateTransient(Width, Height, PixelFormat);
 
 	// Create a new resource for that texture.
 	Texture->UpdateResource();
 
 	// Update texture data.
-	FUpdateTextureRegion2D* TextureRegion = new FUpdateTextureRegion2D(0, 0, 0, 0, Width, Height);
-	auto DataCleanup = [SrcDataCleanup](uint8* Data, const FUpdateTextureRegion2D* UpdateRegion)
-	{
-		SrcDataCleanup(Data);
-		delete UpdateRegion;
-	};
-	Texture->UpdateTextureRegions(0, 1u, TextureRegion, SrcBpp * Width, SrcBpp, SrcData, DataCleanup);
+	UpdateTextureRegion(Texture, Width, SrcBpp, SrcData, { 0, 0, Width, Height }, SrcDataCleanup);
 
 	// Create an entry for the texture.
 	if (Name == NAME_ErrorTexture)
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <PixelFormat.h>
 #include <Styling/SlateBrush.h>
 #include <Textures/SlateShaderResource.h>
 #include <UObject/WeakObjectPtr.h>
@@ -66,11 +67,26 @@ public:
 	// @param Name - The texture name
 	// @param Width - The texture width
 	// @param Height - The texture height
-	// @param SrcBpp - The size in bytes of one pixel
+	// @param SrcBpp - The size in bytes of one pixel (or one block for block-compressed formats)
 	// @param SrcData - The source data
 	// @param SrcDataCleanup - Optional function called to release source data after texture is created (only needed, if data need to be released)
+	// @param PixelFormat - Format of the source data and texture
 	// @returns The index of a texture that was created
-	TextureIndex CreateTexture(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup = [](uint8*) {});
+	TextureIndex CreateTexture(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup = [](uint8*) {}, EPixelFormat PixelFormat = PF_B8G8R8A8);
+
+	// Update a region of a texture created by this manager. Texture is updated in place, so it keeps its index and
+	// resources, but it requires that the source data have the same dimensions and format as the texture.
+	// @param Index - Index of a texture to update
+	// @param Width - The source data width
+	// @param Height - The source data height
+	// @param SrcBpp - The size in bytes of one pixel (or one block for block-compressed formats)
+	// @param SrcData - The source data
+	// @param Region - Region to update, in pixels (the same for the source data and texture), for block-compressed
+	//     formats extended to block boundaries
+	// @param SrcDataCleanup - Optional function called to release source data after texture is updated (only needed, if data need to be released)
+	// @param PixelFormat - Format of the source data
+	// @returns True, if texture was updated or false, if texture at given index cannot be updated in place
+	bool UpdateTexture(TextureIndex Index, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, const FIntRect& Region, TFunction<void(uint8*)> SrcDataCleanup = [](uint8*) {}, EPixelFormat PixelFormat = PF_B8G8R8A8);
 
 	// Create a plain texture.
 	// @param Name - The texture name
@@ -95,7 +111,7 @@ private:
 	// See CreateTexture for general description.
 	// Internal implementations doesn't validate name or resource uniqueness. Instead it uses NAME_ErrorTexture
 	// (aka NAME_None) and INDEX_ErrorTexture (aka INDEX_NONE) to identify ErrorTexture.
-	TextureIndex CreateTextureInternal(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup = [](uint8*) {});
+	TextureIndex CreateTextureInternal(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup = [](uint8*) {}, EPixelFormat PixelFormat = PF_B8G8R8A8);
 
 	// See CreatePlainTexture for general description.
 	// Internal implementations doesn't validate name or resource uniqueness. Instead it uses NAME_ErrorTexture
@@ -138,6 +154,7 @@ private:
 		FTextureEntry& operator=(FTextureEntry&& Other);
 
 		const FName& GetName() const { return Name; }
+		UTexture* GetOwnedTexture() const { return Texture.Get(); }
 		const FSlateResourceHandle& GetResourceHandle() const;
 
 	private:
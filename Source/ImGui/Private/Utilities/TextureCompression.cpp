@@ -0,0 +1,77 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "TextureCompression.h"
+
+
+namespace Utilities
+{
+	namespace
+	{
+		// Encode a 4x4 block of alpha values using BC4 encoding with 8 interpolated values.
+		void EncodeAlphaBlock(const uint8* Src, int32 SrcPitch, uint8* Dst)
+		{
+			uint8 Values[16];
+			uint8 MinValue = 255;
+			uint8 MaxValue = 0;
+			for (int32 Y = 0; Y < TextureBlockSize; Y++)
+			{
+				for (int32 X = 0; X < TextureBlockSize; X++)
+				{
+					const uint8 Value = Src[Y * SrcPitch + X];
+					Values[Y * TextureBlockSize + X] = Value;
+					MinValue = FMath::Min(MinValue, Value);
+					MaxValue = FMath::Max(MaxValue, Value);
+				}
+			}
+
+			// With the first endpoint greater than the second one, the palette consists of both endpoints and six values
+			// interpolated between them. Uniform blocks are encoded with equal endpoints and zero indices.
+			Dst[0] = MaxValue;
+			Dst[1] = MinValue;
+
+			uint64 Indices = 0;
+			if (MaxValue > MinValue)
+			{
+				const int32 Range = MaxValue - MinValue;
+				for (int32 Index = 0; Index < 16; Index++)
+				{
+					// Position between endpoints in sevenths: 0 is the second and 7 the first endpoint. Interpolated
+					// values are stored in order from the first to the second endpoint, with indices 2 to 7.
+					const int32 Step = ((Values[Index] - MinValue) * 14 + Range) / (2 * Range);
+					const uint64 Code = (Step == 7) ? 0 : (Step == 0) ? 1 : 8 - Step;
+					Indices |= Code << (3 * Index);
+				}
+			}
+
+			for (int32 Byte = 0; Byte < 6; Byte++)
+			{
+				Dst[2 + Byte] = static_cast<uint8>(Indices >> (8 * Byte));
+			}
+		}
+	}
+
+	int32 GetDXT5DataSize(int32 Width, int32 Height)
+	{
+		return FMath::DivideAndRoundUp(Width, TextureBlockSize) * FMath::DivideAndRoundUp(Height, TextureBlockSize) * DXT5BlockBytes;
+	}
+
+	void EncodeAlpha8AsDXT5(const uint8* Src, int32 Width, int32 Height, uint8* Dst)
+	{
+		checkf(Width % TextureBlockSize == 0 && Height % TextureBlockSize == 0,
+			TEXT("Texture size %d x %d is not a multiple of the block size."), Width, Height);
+
+		for (int32 BlockY = 0; BlockY < Height; BlockY += TextureBlockSize)
+		{
+			for (int32 BlockX = 0; BlockX < Width; BlockX += TextureBlockSize)
+			{
+				EncodeAlphaBlock(Src + BlockY * Width + BlockX, Width, Dst);
+
+				// Color block with both endpoints white and zero indices.
+				Dst[8] = Dst[9] = Dst[10] = Dst[11] = 0xFF;
+				Dst[12] = Dst[13] = Dst[14] = Dst[15] = 0;
+
+				Dst += DXT5BlockBytes;
+			}
+		}
+	}
+}
@@ -0,0 +1,28 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+
+// Utilities to create block-compressed texture data on the CPU.
+
+namespace Utilities
+{
+	// Width and height of blocks in block-compressed formats.
+	constexpr int32 TextureBlockSize = 4;
+
+	// Size in bytes of one DXT5 (BC3) block.
+	constexpr int32 DXT5BlockBytes = 16;
+
+	// Get the size in bytes of DXT5 (BC3) data for a texture with given dimensions.
+	int32 GetDXT5DataSize(int32 Width, int32 Height);
+
+	// Encode single-channel (alpha) data as DXT5 (BC3) blocks with white color. Alpha blocks use the same encoding as
+	// BC4, so the result uses 1 byte per pixel and can be used with shaders expecting RGBA textures.
+	// @param Src - Source data with 1 byte per pixel
+	// @param Width - The source data width, must be a multiple of TextureBlockSize
+	// @param Height - The source data height, must be a multiple of TextureBlockSize
+	// @param Dst - Destination buffer, which needs to be at least GetDXT5DataSize(Width, Height) bytes long
+	void EncodeAlpha8AsDXT5(const uint8* Src, int32 Width, int32 Height, uint8* Dst);
+}
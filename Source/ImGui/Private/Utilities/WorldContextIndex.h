@@ -15,6 +15,13 @@ namespace Utilities
 	// Standalone context index.
 	inline constexpr int32 STANDALONE_GAME_CONTEXT_INDEX = -2;
 
+	// Map context index to a dense, non-negative slot that can be used to index arrays. Slots start from the standalone
+	// context, which has the lowest valid index, so invalid index maps to a negative slot.
+	FORCEINLINE constexpr int32 GetContextSlot(int32 ContextIndex)
+	{
+		return ContextIndex - STANDALONE_GAME_CONTEXT_INDEX;
+	}
+
 #if WITH_EDITOR
 
 	// Editor context index. We are lacking flexibility here, so we might need to change it somehow.
@@ -93,7 +93,8 @@ void SImGuiWidget::Construct(const FArguments& InArgs)
 	ModuleManager->OnPostImGuiUpdate().AddRaw(this, &SImGuiWidget::OnPostImGuiUpdate);
 
 	// Register debug delegate.
-	auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
+	ContextProxyHandle = ModuleManager->GetContextManager().GetContextProxyHandle(ContextIndex);
+	auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextProxyHandle);
 	checkf(ContextProxy, TEXT("Missing context during widget construction: ContextIndex = %d"), ContextIndex);
 #if IMGUI_WIDGET_DEBUG
 	ContextProxy->OnDraw().AddRaw(this, &SImGuiWidget::OnDebugDraw);
@@ -134,7 +135,7 @@ SImGuiWidget::~SImGuiWidget()
 	ReleaseInputHandler();
 
 	// Remove binding between this widget and its context proxy.
-	if (auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex))
+	if (auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextProxyHandle))
 	{
 #if IMGUI_WIDGET_DEBUG
 		ContextProxy->OnDraw().RemoveAll(this);
@@ -357,7 +358,7 @@ void SImGuiWidget::UpdateMouseCursor()
 {
 	if (!bHideMouseCursor)
 	{
-		const FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
+		const FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextProxyHandle);
 		SetCursor(ContextProxy ? ContextProxy->GetMouseCursor() : EMouseCursor::Default);
 	}
 	else
@@ -432,7 +433,7 @@ void SImGuiWidget::ReturnFocus()
 void SImGuiWidget::UpdateInputState()
 {
 	auto& Properties = ModuleManager->GetProperties();
-	auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
+	auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextProxyHandle);
 
 	const bool bEnableTransparentMouseInput = Properties.IsMouseInputShared()
 #if PLATFORM_ANDROID || PLATFORM_IOS
@@ -587,7 +588,7 @@ void SImGuiWidget::UpdateCanvasSize()
 {
 	if (bUpdateCanvasSize)
 	{
-		if (auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex))
+		if (auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextProxyHandle))
 		{
 			CanvasSize = MinCanvasSize;
 			if (bAdaptiveCanvasSize)
@@ -633,7 +634,7 @@ FVector2D SImGuiWidget::TransformScreenPointToImGui(const FGeometry& MyGeometry,
 int32 SImGuiWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect,
 	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& WidgetStyle, bool bParentEnabled) const
 {
-	if (FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex))
+	if (FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextProxyHandle))
 	{
 		// Manually update ImGui context to minimise lag between creating and rendering ImGui output. This will also
 		// keep frame tearing at minimum because it is executed at the very end of the frame.
@@ -653,8 +654,10 @@ int32 SImGuiWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeo
 		{
 #if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 			DrawList.CopyVertexData(VertexBuffer, ImGuiToScreen, VertexClippingRect);
+			const TArray<FSlateVertex>& Vertices = VertexBuffer;
 #else
-			DrawList.CopyVertexData(VertexBuffer, ImGuiToScreen);
+			// Other widgets presenting the same context in this frame can share converted vertices.
+			const TArray<FSlateVertex>& Vertices = DrawList.GetVertexData(ImGuiToScreen, VertexBuffer);
 #endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 
 			int IndexBufferOffset = 0;
@@ -682,7 +685,7 @@ int32 SImGuiWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeo
 #endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 
 				// Add elements to the list.
-				FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, Handle, VertexBuffer, IndexBuffer, nullptr, 0, 0);
+				FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, Handle, Vertices, IndexBuffer, nullptr, 0, 0);
 
 #if !ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 				OutDrawElements.PopClip();
@@ -845,7 +848,7 @@ namespace Styles
 
 void SImGuiWidget::OnDebugDraw()
 {
-	FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
+	FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextProxyHandle);
 
 	if (CVars::DebugWidget.GetValueOnGameThread() > 0)
 	{
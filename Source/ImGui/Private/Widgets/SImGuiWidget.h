@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "ImGuiContextManager.h"
 #include "ImGuiModuleDebug.h"
 #include "ImGuiModuleSettings.h"
 
@@ -141,6 +142,7 @@ private:
 	mutable TArray<SlateIndex> IndexBuffer;
 
 	int32 ContextIndex = 0;
+	FImGuiContextProxyHandle ContextProxyHandle;
 
 	FVector2D MinCanvasSize = FVector2D::ZeroVector;
 	FVector2D CanvasSize = FVector2D::ZeroVector;
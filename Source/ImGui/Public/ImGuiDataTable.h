@@ -0,0 +1,231 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Async/Future.h>
+#include <Misc/StringBuilder.h>
+#include <Templates/Function.h>
+#include <Templates/SharedPointer.h>
+
+#include <imgui.h>
+
+#include <atomic>
+
+
+/**
+ * Filter of table rows, with comma-separated terms and '-' prefix for excluded terms (like ImGuiTextFilter). Terms are
+ * matched ignoring case. Unlike ImGuiTextFilter, it doesn't use ImGui memory and can be used on worker threads.
+ */
+struct IMGUI_API FImGuiTableFilter
+{
+	TArray<TArray<ANSICHAR>> IncludedTerms;
+	TArray<TArray<ANSICHAR>> ExcludedTerms;
+
+	FImGuiTableFilter() = default;
+	explicit FImGuiTableFilter(const char* Text);
+
+	/** Whether the filter has any terms. */
+	bool IsActive() const { return IncludedTerms.Num() > 0 || ExcludedTerms.Num() > 0; }
+
+	/** Whether a text contains any of the included terms (or there are none) and none of the excluded terms. */
+	bool PassFilter(const ANSICHAR* Text) const;
+};
+
+/**
+ * Data shown by FImGuiDataTable. Sorting and filtering call GetNumRows, FormatCell, CompareRows and PassFilter on
+ * worker threads, concurrently with each other and with drawing on the game thread, so they need to be safe to call
+ * from multiple threads and data they read must not change while the table uses the source. The simplest way to
+ * achieve that is to keep data in immutable sources and to set a new source when data change.
+ */
+class IMGUI_API IImGuiTableDataSource
+{
+public:
+
+	virtual ~IImGuiTableDataSource() = default;
+
+	/** Get the number of columns. */
+	virtual int32 GetNumColumns() const = 0;
+
+	/** Get the name of a column, in UTF-8. */
+	virtual const char* GetColumnName(int32 Column) const = 0;
+
+	/** Get flags of a column (see ImGui::TableSetupColumn). */
+	virtual ImGuiTableColumnFlags GetColumnFlags(int32 Column) const { return ImGuiTableColumnFlags_None; }
+
+	/** Get the number of rows. */
+	virtual int32 GetNumRows() const = 0;
+
+	/** Append UTF-8 text of a cell. */
+	virtual void FormatCell(int32 Row, int32 Column, FAnsiStringBuilderBase& Out) const = 0;
+
+	/**
+	 * Compare two rows by a column. By default compares formatted cells as text, ignoring case, so sources with numeric
+	 * columns should override it.
+	 * @returns Negative value, if the first row goes first, positive value, if the second row goes first, or zero
+	 */
+	virtual int32 CompareRows(int32 RowA, int32 RowB, int32 Column) const;
+
+	/** Whether a row passes a filter. By default the filter is applied to formatted cells separated with tabs. */
+	virtual bool PassFilter(int32 Row, const FImGuiTableFilter& Filter) const;
+
+	/** Draw a cell in the current table column. Called on the game thread. By default draws formatted cell as text. */
+	virtual void DrawCell(int32 Row, int32 Column) const;
+};
+
+/**
+ * Data source over an array of rows, with columns defined by functions formatting and comparing rows.
+ *
+ * Example:
+ *   auto Source = MakeShared<TImGuiArrayTableDataSource<FMyRow>, ESPMode::ThreadSafe>(MoveTemp(Rows));
+ *   Source->AddColumn("Name", [](const FMyRow& Row, FAnsiStringBuilderBase& Out) { Out << Row.Name; });
+ *   Source->AddColumn("Count", [](const FMyRow& Row, FAnsiStringBuilderBase& Out) { Out << Row.Count; },
+ *       [](const FMyRow& A, const FMyRow& B) { return A.Count < B.Count ? -1 : (A.Count > B.Count ? 1 : 0); });
+ *   Table.SetDataSource(Source);
+ */
+template<typename TRow>
+class TImGuiArrayTableDataSource : public IImGuiTableDataSource
+{
+public:
+
+	using FFormatter = TFunction<void(const TRow&, FAnsiStringBuilderBase&)>;
+	using FComparator = TFunction<int32(const TRow&, const TRow&)>;
+
+	explicit TImGuiArrayTableDataSource(TArray<TRow>&& InRows)
+		: Rows(MoveTemp(InRows))
+	{
+	}
+
+	/**
+	 * Add a column. Columns should be added before the source is passed to a table.
+	 * @param Name - Name of the column, in UTF-8
+	 * @param Formatter - Function appending UTF-8 text of a cell
+	 * @param Comparator - Function comparing rows by this column or null to compare formatted text
+	 * @param Flags - Column flags (see ImGui::TableSetupColumn)
+	 */
+	TImGuiArrayTableDataSource& AddColumn(const char* Name, FFormatter Formatter, FComparator Comparator = nullptr,
+		ImGuiTableColumnFlags Flags = ImGuiTableColumnFlags_None)
+	{
+		FColumn& Column = Columns.AddDefaulted_GetRef();
+		Column.Name.Append(Name, FCStringAnsi::Strlen(Name) + 1);
+		Column.Formatter = MoveTemp(Formatter);
+		Column.Comparator = MoveTemp(Comparator);
+		Column.Flags = Flags;
+		return *this;
+	}
+
+	const TArray<TRow>& GetRows() const { return Rows; }
+
+	//~ IImGuiTableDataSource interface
+	virtual int32 GetNumColumns() const override { return Columns.Num(); }
+	virtual const char* GetColumnName(int32 Column) const override { return Columns[Column].Name.GetData(); }
+	virtual ImGuiTableColumnFlags GetColumnFlags(int32 Column) const override { return Columns[Column].Flags; }
+	virtual int32 GetNumRows() const override { return Rows.Num(); }
+
+	virtual void FormatCell(int32 Row, int32 Column, FAnsiStringBuilderBase& Out) const override
+	{
+		Columns[Column].Formatter(Rows[Row], Out);
+	}
+
+	virtual int32 CompareRows(int32 RowA, int32 RowB, int32 Column) const override
+	{
+		const FColumn& ColumnData = Columns[Column];
+		return ColumnData.Comparator ? ColumnData.Comparator(Rows[RowA], Rows[RowB])
+			: IImGuiTableDataSource::CompareRows(RowA, RowB, Column);
+	}
+
+private:
+
+	struct FColumn
+	{
+		TArray<ANSICHAR> Name;
+		FFormatter Formatter;
+		FComparator Comparator;
+		ImGuiTableColumnFlags Flags = ImGuiTableColumnFlags_None;
+	};
+
+	TArray<TRow> Rows;
+	TArray<FColumn> Columns;
+};
+
+/**
+ * Table showing rows of a data source, for tables too large to sort in a frame. Sorting (by clicking column headers,
+ * with shift to sort by multiple columns) and filtering run on worker threads and produce a list of row indices, while
+ * the table keeps showing the previous list. Only visible rows are drawn, using ImGuiListClipper.
+ *
+ * The table should be drawn in one ImGui context, since it keeps its sort order and filter between frames.
+ */
+class IMGUI_API FImGuiDataTable
+{
+public:
+
+	/** Default table flags. Tables need ImGuiTableFlags_Sortable to be sorted and ImGuiTableFlags_ScrollY to benefit from clipping. */
+	static constexpr ImGuiTableFlags DefaultFlags = ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti
+		| ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_RowBg
+		| ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY;
+
+	/**
+	 * @param InId - Id of the table, in UTF-8
+	 * @param InFlags - Table flags (see ImGui::BeginTable)
+	 */
+	explicit FImGuiDataTable(const char* InId, ImGuiTableFlags InFlags = DefaultFlags);
+
+	~FImGuiDataTable();
+
+	FImGuiDataTable(const FImGuiDataTable&) = delete;
+	FImGuiDataTable& operator=(const FImGuiDataTable&) = delete;
+
+	FImGuiDataTable(FImGuiDataTable&&) = delete;
+	FImGuiDataTable& operator=(FImGuiDataTable&&) = delete;
+
+	/**
+	 * Set the source of rows. Until its rows are sorted and filtered, the table shows rows of the previous source or,
+	 * if there wasn't one, rows of the new source in their original order.
+	 */
+	void SetDataSource(const TSharedPtr<IImGuiTableDataSource, ESPMode::ThreadSafe>& InDataSource);
+
+	/**
+	 * Sort and filter rows of the current source again. Sources must not change while the table uses them, so changed
+	 * data should be passed in a new source using SetDataSource.
+	 */
+	void Refresh();
+
+	/** Draw the filter and the table. */
+	void Draw(const ImVec2& Size = ImVec2(0.f, 0.f));
+
+	/** Whether rows are being sorted or filtered in the background. */
+	bool IsUpdating() const { return Task.IsValid(); }
+
+private:
+
+	struct FSortColumn
+	{
+		int32 Column = 0;
+		bool bDescending = false;
+	};
+
+	void StartUpdate();
+	void CancelUpdate();
+	void FinishUpdate();
+
+	static TArray<int32> SortAndFilter(const IImGuiTableDataSource& Source, const TArray<FSortColumn>& SortColumns,
+		const char* FilterText, const std::atomic<bool>& bCancelled);
+
+	TArray<ANSICHAR> Id;
+	ImGuiTableFlags Flags;
+
+	// The latest source.
+	TSharedPtr<IImGuiTableDataSource, ESPMode::ThreadSafe> DataSource;
+
+	// Source and its rows that are currently shown.
+	TSharedPtr<IImGuiTableDataSource, ESPMode::ThreadSafe> ShownSource;
+	TArray<int32> ShownRows;
+	bool bShowAllRows = true;
+
+	TArray<FSortColumn> SortColumns;
+	char FilterText[256] = {};
+
+	// Sorting and filtering of the latest source.
+	TFuture<TArray<int32>> Task;
+	TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> TaskCancelled;
+};
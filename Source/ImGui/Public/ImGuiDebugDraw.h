@@ -0,0 +1,78 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiDelegates.h"
+
+#include <CoreMinimal.h>
+
+
+class UWorld;
+
+/**
+ * Immediate debug primitives drawn on top of ImGui windows, in foreground draw lists of ImGui contexts. They are a cheap
+ * alternative to DrawDebug* functions, which render through the world.
+ *
+ * Functions can be called from any thread. Primitives are added to a lock-free queue of the calling thread and drawn
+ * by contexts at the end of their frames. Primitives are drawn in the context of a given world or in all contexts when
+ * world is null. Screen space positions are in ImGui display coordinates. World space positions are projected with
+ * the view of the first local player of a context's world, so they are not drawn in contexts without local players
+ * (like the editor context). Lifetime is in seconds of real time, with non-positive lifetime drawing a primitive once.
+ *
+ * Each thread can have up to 2048 primitives waiting to be drawn and up to 65536 primitives can be drawn at once.
+ * Primitives over these limits are dropped and counted. When ImGui draw delegates are disabled (see
+ * IMGUI_WITH_DELEGATES), all functions are inline no-ops.
+ */
+class IMGUI_API FImGuiDebugDraw
+{
+public:
+
+	/** Draw a line in screen space. */
+	static void ScreenLine(const UWorld* World, const FVector2D& Start, const FVector2D& End, const FColor& Color,
+		float Thickness = 1.f, float Lifetime = 0.f);
+
+	/** Draw a rectangle outline in screen space. */
+	static void ScreenRect(const UWorld* World, const FVector2D& Min, const FVector2D& Max, const FColor& Color,
+		float Thickness = 1.f, float Lifetime = 0.f);
+
+	/** Draw a circle outline in screen space. */
+	static void ScreenCircle(const UWorld* World, const FVector2D& Center, float Radius, const FColor& Color,
+		float Thickness = 1.f, float Lifetime = 0.f);
+
+	/** Draw a text label in screen space. Labels longer than 63 bytes in UTF-8 are truncated. */
+	static void ScreenText(const UWorld* World, const FVector2D& Position, const FString& Label, const FColor& Color,
+		float Lifetime = 0.f);
+
+	/** Draw a line in world space. */
+	static void Line(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color,
+		float Thickness = 1.f, float Lifetime = 0.f);
+
+	/** Draw a box outline in world space. */
+	static void Box(const UWorld* World, const FVector& Center, const FVector& Extent, const FColor& Color,
+		const FQuat& Rotation = FQuat::Identity, float Thickness = 1.f, float Lifetime = 0.f);
+
+	/** Draw a circle outline in world space, in a plane with a given normal. */
+	static void Circle(const UWorld* World, const FVector& Center, float Radius, const FColor& Color,
+		const FVector& Normal = FVector::UpVector, float Thickness = 1.f, float Lifetime = 0.f);
+
+	/** Draw a text label at a world location. Labels longer than 63 bytes in UTF-8 are truncated. */
+	static void Text(const UWorld* World, const FVector& Location, const FString& Label, const FColor& Color,
+		float Lifetime = 0.f);
+
+	/** Get the number of primitives dropped because queues were full. */
+	static uint64 GetNumDroppedPrimitives();
+};
+
+#if !IMGUI_WITH_DELEGATES
+
+inline void FImGuiDebugDraw::ScreenLine(const UWorld*, const FVector2D&, const FVector2D&, const FColor&, float, float) {}
+inline void FImGuiDebugDraw::ScreenRect(const UWorld*, const FVector2D&, const FVector2D&, const FColor&, float, float) {}
+inline void FImGuiDebugDraw::ScreenCircle(const UWorld*, const FVector2D&, float, const FColor&, float, float) {}
+inline void FImGuiDebugDraw::ScreenText(const UWorld*, const FVector2D&, const FString&, const FColor&, float) {}
+inline void FImGuiDebugDraw::Line(const UWorld*, const FVector&, const FVector&, const FColor&, float, float) {}
+inline void FImGuiDebugDraw::Box(const UWorld*, const FVector&, const FVector&, const FColor&, const FQuat&, float, float) {}
+inline void FImGuiDebugDraw::Circle(const UWorld*, const FVector&, float, const FColor&, const FVector&, float, float) {}
+inline void FImGuiDebugDraw::Text(const UWorld*, const FVector&, const FString&, const FColor&, float) {}
+inline uint64 FImGuiDebugDraw::GetNumDroppedPrimitives() { return 0; }
+
+#endif // !IMGUI_WITH_DELEGATES
@@ -0,0 +1,114 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiDelegates.h"
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+
+class UWorld;
+struct FImGuiDeferredBatch;
+
+/**
+ * Records ImGui commands on any thread, to replay them in the next debug frame. Systems running in parallel or async
+ * tasks can use it to show their state without copying it back to the game thread.
+ *
+ * Commands recorded by one instance form a batch, which is submitted when the instance is destroyed. Every thread
+ * records to its own buffers, so recording doesn't lock or wait for other threads. Submitted batches are replayed in
+ * submission order during the next debug event of their target context, after world debug delegates and before
+ * multi-context debug delegates. An instance must be destroyed on the thread that created it.
+ *
+ * During replay, commands inside collapsed tree nodes are skipped and tree nodes still open at the end of a batch are
+ * closed. When ImGui draw delegates are disabled (see IMGUI_WITH_DELEGATES), all functions are inline no-ops.
+ *
+ * Example:
+ *   FImGuiDeferredCommands Commands("Crowd");
+ *   Commands.Text("Agents: %d", Agents.Num());
+ *   Commands.PlotLines("Update Time", Times.GetData(), Times.Num());
+ */
+class IMGUI_API FImGuiDeferredCommands
+{
+public:
+
+	/**
+	 * Start a batch replayed in every context.
+	 * @param WindowName - Name of the window to draw to or null to draw to the default debug window
+	 */
+	explicit FImGuiDeferredCommands(const char* WindowName = nullptr);
+
+	/**
+	 * Start a batch replayed in the context of a given world.
+	 * @param World - World that should show the batch (only used to find its context, which is done immediately)
+	 * @param WindowName - Name of the window to draw to or null to draw to the default debug window
+	 */
+	FImGuiDeferredCommands(const UWorld* World, const char* WindowName = nullptr);
+
+	/** Submit the batch. */
+	~FImGuiDeferredCommands();
+
+	FImGuiDeferredCommands(const FImGuiDeferredCommands&) = delete;
+	FImGuiDeferredCommands& operator=(const FImGuiDeferredCommands&) = delete;
+
+	FImGuiDeferredCommands(FImGuiDeferredCommands&&) = delete;
+	FImGuiDeferredCommands& operator=(FImGuiDeferredCommands&&) = delete;
+
+	/** Record formatted text (see ImGui::Text). Text is formatted immediately. */
+	void Text(const char* Fmt, ...) IM_FMTARGS(2);
+
+	/** Record formatted colored text (see ImGui::TextColored). Text is formatted immediately. */
+	void TextColored(const ImVec4& Color, const char* Fmt, ...) IM_FMTARGS(3);
+
+	/** Record a labeled value (see ImGui::Value). */
+	void Value(const char* Label, bool bValue);
+	void Value(const char* Label, int32 IntValue);
+	void Value(const char* Label, float FloatValue, const char* Format = nullptr);
+
+	/** Record a line plot of values, which are copied (see ImGui::PlotLines). */
+	void PlotLines(const char* Label, const float* Values, int32 Count, const char* Overlay = nullptr,
+		float ScaleMin = FLT_MAX, float ScaleMax = FLT_MAX, const ImVec2& GraphSize = ImVec2(0.f, 0.f));
+
+	/** Record a histogram of values, which are copied (see ImGui::PlotHistogram). */
+	void PlotHistogram(const char* Label, const float* Values, int32 Count, const char* Overlay = nullptr,
+		float ScaleMin = FLT_MAX, float ScaleMax = FLT_MAX, const ImVec2& GraphSize = ImVec2(0.f, 0.f));
+
+	/**
+	 * Record a tree node (see ImGui::TreeNode). Commands up to the matching TreePop are only replayed when the node is
+	 * open.
+	 */
+	void TreeNode(const char* Label);
+
+	/** Record the end of the last tree node. */
+	void TreePop();
+
+	/** Record a separator (see ImGui::Separator). */
+	void Separator();
+
+	/** Record placing the next command on the same line (see ImGui::SameLine). */
+	void SameLine(float OffsetFromStartX = 0.f, float Spacing = -1.f);
+
+private:
+
+	FImGuiDeferredBatch* Batch = nullptr;
+};
+
+#if !IMGUI_WITH_DELEGATES
+
+inline FImGuiDeferredCommands::FImGuiDeferredCommands(const char*) {}
+inline FImGuiDeferredCommands::FImGuiDeferredCommands(const UWorld*, const char*) {}
+inline FImGuiDeferredCommands::~FImGuiDeferredCommands() {}
+inline void FImGuiDeferredCommands::Text(const char*, ...) {}
+inline void FImGuiDeferredCommands::TextColored(const ImVec4&, const char*, ...) {}
+inline void FImGuiDeferredCommands::Value(const char*, bool) {}
+inline void FImGuiDeferredCommands::Value(const char*, int32) {}
+inline void FImGuiDeferredCommands::Value(const char*, float, const char*) {}
+inline void FImGuiDeferredCommands::PlotLines(const char*, const float*, int32, const char*, float, float, const ImVec2&) {}
+inline void FImGuiDeferredCommands::PlotHistogram(const char*, const float*, int32, const char*, float, float, const ImVec2&) {}
+inline void FImGuiDeferredCommands::TreeNode(const char*) {}
+inline void FImGuiDeferredCommands::TreePop() {}
+inline void FImGuiDeferredCommands::Separator() {}
+inline void FImGuiDeferredCommands::SameLine(float, float) {}
+
+#endif // !IMGUI_WITH_DELEGATES
@@ -7,6 +7,15 @@
 
 class UWorld;
 
+/**
+ * Whether ImGui draw delegates are available. Runtime lite builds (see bRuntimeLite in ImGui.Build.cs) disable them in
+ * shipping configuration, leaving inline no-ops, so code registering for debug events compiles without changes and
+ * costs nothing per frame.
+ */
+#ifndef IMGUI_WITH_DELEGATES
+#define IMGUI_WITH_DELEGATES !(IMGUI_RUNTIME_LITE && UE_BUILD_SHIPPING)
+#endif
+
 /**
  * Delegates to ImGui debug events. World delegates are called once per frame during world updates and have invocation
  * lists cleared after their worlds become invalid. Multi-context delegates are called once for every updated world.
@@ -59,6 +68,31 @@ public:
 	static FSimpleMulticastDelegate& OnMultiContextDebug();
 };
 
+#if !IMGUI_WITH_DELEGATES
+
+namespace ImGuiDelegatesDetail
+{
+	/**
+	 * Delegate returned when ImGui draw delegates are disabled. It is never broadcast, so bindings added through the
+	 * previous reference are cleared, releasing their objects and keeping the invocation list from growing.
+	 */
+	inline FSimpleMulticastDelegate& GetDisabledDelegate()
+	{
+		static thread_local FSimpleMulticastDelegate Delegate;
+		Delegate.Clear();
+		return Delegate;
+	}
+}
+
+inline FSimpleMulticastDelegate& FImGuiDelegates::OnWorldEarlyDebug() { return ImGuiDelegatesDetail::GetDisabledDelegate(); }
+inline FSimpleMulticastDelegate& FImGuiDelegates::OnWorldEarlyDebug(UWorld*) { return ImGuiDelegatesDetail::GetDisabledDelegate(); }
+inline FSimpleMulticastDelegate& FImGuiDelegates::OnMultiContextEarlyDebug() { return ImGuiDelegatesDetail::GetDisabledDelegate(); }
+inline FSimpleMulticastDelegate& FImGuiDelegates::OnWorldDebug() { return ImGuiDelegatesDetail::GetDisabledDelegate(); }
+inline FSimpleMulticastDelegate& FImGuiDelegates::OnWorldDebug(UWorld*) { return ImGuiDelegatesDetail::GetDisabledDelegate(); }
+inline FSimpleMulticastDelegate& FImGuiDelegates::OnMultiContextDebug() { return ImGuiDelegatesDetail::GetDisabledDelegate(); }
+
+#endif // !IMGUI_WITH_DELEGATES
+
 
 /** Enable to support legacy ImGui delegates API. */
 #define IMGUI_WITH_OBSOLETE_DELEGATES 1
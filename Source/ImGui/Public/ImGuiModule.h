@@ -120,6 +120,17 @@ public:
 
 	virtual void RebuildFontAtlas();
 
+	/**
+	 * Set the DPI scale for ImGui context of a given world, overriding the scale from the module settings. Contexts
+	 * with different scales use separate font atlases, which are built in the background and kept for a few recently
+	 * used scales. Until the atlas for a new scale is ready, context keeps its current scale.
+	 *
+	 * @param World - World for which the scale should be set (or null for the editor or standalone game context). In the
+	 *     editor, worlds other than game and PIE worlds use the editor context, like when they are drawn.
+	 * @param Scale - The DPI scale or non-positive value to restore the scale from the module settings
+	 */
+	virtual void SetWorldDPIScale(const UWorld* World, float Scale);
+
 	/**
 	 * Get ImGui module properties.
 	 *
@@ -179,6 +190,7 @@ public:
 private:
 #if WITH_EDITOR
 	virtual void SetProperties(const FImGuiModuleProperties& Properties);
+	virtual void ActivateAfterReload();
 	struct FImGuiContextHandle* ImGuiContextHandle = nullptr;
 	struct FImGuiDelegatesContainerHandle* DelegatesContainerHandle = nullptr;
 	friend struct FImGuiContextHandle;
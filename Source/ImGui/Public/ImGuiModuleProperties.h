@@ -3,6 +3,7 @@
 #pragma once
 
 struct ImFontConfig;
+class UFontFace;
 
 /** Properties that define state of the ImGui module. */
 class IMGUI_API FImGuiModuleProperties
@@ -12,8 +13,8 @@ public:
 	/** Check whether input is enabled. */
 	bool IsInputEnabled() const { return bInputEnabled; }
 
-	/** Enable or disable ImGui input. */
-	void SetInputEnabled(bool bEnabled) { bInputEnabled = bEnabled; }
+	/** Enable or disable ImGui input. Enabling input starts a module waiting for the first use. */
+	void SetInputEnabled(bool bEnabled);
 
 	/** Toggle ImGui input. */
 	void ToggleInput() { SetInputEnabled(!IsInputEnabled()); }
@@ -66,15 +67,46 @@ public:
 	/** Check whether ImGui demo is visible. */
 	bool ShowDemo() const { return bShowDemo; }
 
-	/** Show or hide ImGui demo. */
-	void SetShowDemo(bool bShow) { bShowDemo = bShow; }
+	/** Show or hide ImGui demo. Showing the demo starts a module waiting for the first use. */
+	void SetShowDemo(bool bShow);
 
 	/** Toggle ImGui demo. */
 	void ToggleDemo() { SetShowDemo(!ShowDemo()); }
 
+	/** Check whether log window is visible. */
+	bool ShowLog() const { return bShowLog; }
+
+	/** Show or hide log window. Showing the log starts a module waiting for the first use. */
+	void SetShowLog(bool bShow);
+
+	/** Toggle log window. */
+	void ToggleLog() { SetShowLog(!ShowLog()); }
+
 	/** Adds a new font to initialize */
 	void AddCustomFont(FName FontName, TSharedPtr<ImFontConfig> Font) { CustomFonts.Emplace(FontName, Font); }
 
+	/**
+	 * Adds a new font from a font file. File is memory-mapped and font atlases read from that mapping, without copying
+	 * font data. Mapping is released after the font is removed and font atlases that use it are built.
+	 *
+	 * @param FontName - Name of the custom font
+	 * @param Filename - Path to a TTF/OTF font file
+	 * @param FontConfig - Font parameters (font data fields are ignored)
+	 * @returns True, if font was added or false, if file couldn't be opened
+	 */
+	bool AddCustomFontFromFile(FName FontName, const FString& Filename, const ImFontConfig& FontConfig);
+
+	/**
+	 * Adds a new font from a font face asset. Inline font data are referenced directly, otherwise the font file is
+	 * memory-mapped, like in AddCustomFontFromFile.
+	 *
+	 * @param FontName - Name of the custom font
+	 * @param FontFace - Font face asset
+	 * @param FontConfig - Font parameters (font data fields are ignored)
+	 * @returns True, if font was added or false, if font face has no data
+	 */
+	bool AddCustomFontFromFontFace(FName FontName, const UFontFace* FontFace, const ImFontConfig& FontConfig);
+
 	/** Removes a font from the custom font list */
 	void RemoveCustomFont(FName FontName) { CustomFonts.Remove(FontName); }
 
@@ -93,6 +125,7 @@ private:
 	bool bMouseInputShared = false;
 
 	bool bShowDemo = false;
+	bool bShowLog = false;
 
 	TMap<FName, TSharedPtr<ImFontConfig>> CustomFonts;
 };
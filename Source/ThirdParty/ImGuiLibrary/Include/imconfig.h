@@ -134,3 +134,42 @@ namespace ImGui
     void MyFunction(const char* name, MyMatrix44* mtx);
 }
 */
+
+//---- Unreal ImGui: Hook called by ImFont::RenderChar() and ImFont::RenderText() when a glyph is missing from the font
+// atlas. The plugin uses it to rasterize glyphs on demand (see FImGuiGlyphCache).
+struct ImFont;
+namespace ImGuiGlyphCache { void OnMissingGlyph(const ImFont* Font, unsigned int Codepoint); }
+#define IMGUI_ON_MISSING_GLYPH(_FONT, _CODEPOINT)   ImGuiGlyphCache::OnMissingGlyph(_FONT, _CODEPOINT)
+
+//---- Unreal ImGui: Parallel loop used by the stb_truetype font builder to rasterize glyphs on multiple threads. Calls
+// _FUNC(Index, _USER_DATA) for each index in [0, _COUNT) and returns after all calls are finished.
+namespace ImGuiFontBuilder { void ParallelFor(int Count, void (*Func)(int Index, void* UserData), void* UserData); }
+#define IMGUI_PARALLEL_FOR(_COUNT, _FUNC, _USER_DATA)   ImGuiFontBuilder::ParallelFor(_COUNT, _FUNC, _USER_DATA)
+
+//---- Unreal ImGui: Returns true on threads that must not access the current context (GImGui), like font atlas builds
+// running on worker threads. ImGui::MemAlloc() and ImGui::MemFree() don't record their allocations in that context.
+namespace ImGuiImplementation { bool IsContextFreeThread(); }
+#define IMGUI_CONTEXT_FREE_THREAD()   ImGuiImplementation::IsContextFreeThread()
+
+//---- Unreal ImGui: Hooks used by ImFont::CalcTextSizeA() and ImFont::RenderText() to cache measurements and word wrap
+// positions of repeated strings in a per-context cache (see FImGuiTextCache). Comment out IMGUI_TEXT_CACHE to disable.
+struct ImVec2;
+namespace ImGuiTextCache
+{
+    bool FindTextSize(const ImFont* Font, float Size, float MaxWidth, float WrapWidth, const char* TextBegin, const char* TextEnd, unsigned long long* OutHash, ImVec2* OutSize, const char** OutRemaining);
+    void AddTextSize(unsigned long long Hash, const ImFont* Font, float Size, float MaxWidth, float WrapWidth, const char* TextBegin, const char* TextEnd, const ImVec2& TextSize, const char* Remaining);
+    void* FindWordWrap(const ImFont* Font, float Scale, float WrapWidth, const char* TextBegin, const char* TextEnd);
+    const char* CalcWordWrapPosition(void* WordWrap, const ImFont* Font, float Scale, float WrapWidth, const char* TextBegin, const char* Text, const char* TextEnd);
+}
+#define IMGUI_TEXT_CACHE
+
+//---- Unreal ImGui: Use open addressing for ImGuiStorage (tree node open states, per-window state and other per-ID
+// lookups) instead of a sorted vector. Insertion is O(1) instead of O(N), which helps with very large trees, at the cost
+// of an extra index table and pairs no longer being sorted by key.
+//#define IMGUI_STORAGE_OPEN_ADDRESSING
+
+//---- Unreal ImGui: Runtime lite builds (see bRuntimeLite in ImGui.Build.cs) don't include demo windows and debug tools.
+#if defined(IMGUI_RUNTIME_LITE) && IMGUI_RUNTIME_LITE
+#define IMGUI_DISABLE_DEMO_WINDOWS
+#define IMGUI_DISABLE_DEBUG_TOOLS
+#endif
@@ -2582,11 +2582,20 @@ struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_STORAGE_OPEN_ADDRESSING
+    // Unreal ImGui: Pairs in Data are unsorted and indexed by an open addressing table (see imconfig.h).
+    ImVector<int>                   _Index;
+    int                             _IndexedSize = 0;
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+#ifdef IMGUI_STORAGE_OPEN_ADDRESSING
+    IMGUI_API void      Clear();
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -3199,6 +3208,7 @@ struct ImFontConfig
     void*           FontData;               //          // TTF/OTF data
     int             FontDataSize;           //          // TTF/OTF data size
     bool            FontDataOwnedByAtlas;   // true     // TTF/OTF data ownership taken by the container ImFontAtlas (will delete memory itself).
+    bool            FontDataReferenced;     // false    // Unreal ImGui: Reference data not owned by the atlas instead of copying it. THE DATA NEEDS TO PERSIST AS LONG AS THE ATLAS IS ALIVE.
     int             FontNo;                 // 0        // Index of font within TTF/OTF file
     float           SizePixels;             //          // Size in pixels for rasterizer (more or less maps to the resulting font height).
     int             OversampleH;            // 2        // Rasterize at higher quality for sub-pixel positioning. Note the difference between 2 and 3 is minimal. You can reduce this to 1 for large glyphs save memory. Read https://github.com/nothings/stb/blob/master/tests/oversample/README.md for details.
@@ -2345,6 +2345,18 @@ int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const cha
     ImWchar* buf_end = buf + buf_size;
     while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
+        // Unreal ImGui: Widen runs of ASCII characters without decoding
+        if (in_text_end)
+        {
+            const int ascii_count = ImMin(ImTextCountAsciiRun(in_text, in_text_end, 1), (int)(buf_end - 1 - buf_out));
+            for (int i = 0; i < ascii_count; i++)
+                buf_out[i] = (ImWchar)in_text[i];
+            buf_out += ascii_count;
+            in_text += ascii_count;
+            if (ascii_count > 0)
+                continue;
+        }
+
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         *buf_out++ = (ImWchar)c;
@@ -2360,6 +2372,16 @@ int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
     int char_count = 0;
     while ((!in_text_end || in_text < in_text_end) && *in_text)
     {
+        // Unreal ImGui: Count runs of ASCII characters without decoding
+        if (in_text_end)
+        {
+            const int ascii_count = ImTextCountAsciiRun(in_text, in_text_end, 1);
+            char_count += ascii_count;
+            in_text += ascii_count;
+            if (ascii_count > 0)
+                continue;
+        }
+
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         char_count++;
@@ -2603,6 +2625,162 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+#ifdef IMGUI_STORAGE_OPEN_ADDRESSING
+//---- Unreal ImGui: Open addressing implementation (see IMGUI_STORAGE_OPEN_ADDRESSING in imconfig.h). Pairs are stored
+// unsorted in Data and indexed by a linear probing table of Data indices + 1 (0 for empty slots), with at most half of
+// the slots used. Insertion appends to Data, so it is O(1) instead of O(N). The index is rebuilt when Data is sorted,
+// grows over the load factor or is modified directly (detected by its size).
+
+static inline ImU32 ImGuiStorageHashKey(ImGuiID key)
+{
+    // IDs are already hashed but may differ only in low bits, so mix them again before masking
+    key ^= key >> 16; key *= 0x7FEB352Du;
+    key ^= key >> 15; key *= 0x846CA68Bu;
+    key ^= key >> 16;
+    return key;
+}
+
+static void ImGuiStorageRebuildIndex(ImGuiStorage* storage)
+{
+    int slots_count = 16;
+    while (slots_count < storage->Data.Size * 2)
+        slots_count <<= 1;
+    storage->_Index.resize(slots_count);
+    memset(storage->_Index.Data, 0, (size_t)storage->_Index.size_in_bytes());
+    const ImU32 mask = (ImU32)slots_count - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        ImU32 i = ImGuiStorageHashKey(storage->Data.Data[n].key) & mask;
+        while (storage->_Index.Data[i] != 0)
+            i = (i + 1) & mask;
+        storage->_Index.Data[i] = n + 1;
+    }
+    storage->_IndexedSize = storage->Data.Size;
+}
+
+// Return slot holding the key, or the empty slot where it should be inserted.
+static int* ImGuiStorageFindSlot(ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->_Index.Size == 0 || storage->_IndexedSize != storage->Data.Size)
+        ImGuiStorageRebuildIndex(storage);
+    const ImU32 mask = (ImU32)storage->_Index.Size - 1;
+    for (ImU32 i = ImGuiStorageHashKey(key) & mask; ; i = (i + 1) & mask)
+    {
+        int* slot = &storage->_Index.Data[i];
+        if (*slot == 0 || storage->Data.Data[*slot - 1].key == key)
+            return slot;
+    }
+}
+
+static ImGuiStoragePair* ImGuiStorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->Data.Size == 0)
+        return NULL;
+    // Index is rebuilt lazily, hence the const_cast
+    const int* slot = ImGuiStorageFindSlot(const_cast<ImGuiStorage*>(storage), key);
+    return *slot ? const_cast<ImGuiStoragePair*>(&storage->Data.Data[*slot - 1]) : NULL;
+}
+
+template<typename T>
+static ImGuiStoragePair* ImGuiStorageFindOrAdd(ImGuiStorage* storage, ImGuiID key, T default_val)
+{
+    int* slot = ImGuiStorageFindSlot(storage, key);
+    if (*slot)
+        return &storage->Data.Data[*slot - 1];
+    storage->Data.push_back(ImGuiStoragePair(key, default_val));
+    *slot = storage->Data.Size;
+    storage->_IndexedSize = storage->Data.Size;
+    if (storage->Data.Size * 2 > storage->_Index.Size)
+        ImGuiStorageRebuildIndex(storage);
+    return &storage->Data.back();
+}
+
+void ImGuiStorage::Clear()
+{
+    Data.clear();
+    _Index.clear();
+    _IndexedSize = 0;
+}
+
+// Pairs don't need to be sorted for lookups, but this keeps iteration order stable (e.g. for ImGuiSelectionBasicStorage).
+void ImGuiStorage::BuildSortByKey()
+{
+    ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    ImGuiStorageRebuildIndex(this);
+}
+
+int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
+{
+    const ImGuiStoragePair* it = ImGuiStorageFind(this, key);
+    return it ? it->val_i : default_val;
+}
+
+float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
+{
+    const ImGuiStoragePair* it = ImGuiStorageFind(this, key);
+    return it ? it->val_f : default_val;
+}
+
+void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
+{
+    const ImGuiStoragePair* it = ImGuiStorageFind(this, key);
+    return it ? it->val_p : NULL;
+}
+
+// References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
+int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
+{
+    return &ImGuiStorageFindOrAdd(this, key, default_val)->val_i;
+}
+
+float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
+{
+    return &ImGuiStorageFindOrAdd(this, key, default_val)->val_f;
+}
+
+void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
+{
+    return &ImGuiStorageFindOrAdd(this, key, default_val)->val_p;
+}
+
+void ImGuiStorage::SetInt(ImGuiID key, int val)
+{
+    ImGuiStorageFindOrAdd(this, key, val)->val_i = val;
+}
+
+void ImGuiStorage::SetFloat(ImGuiID key, float val)
+{
+    ImGuiStorageFindOrAdd(this, key, val)->val_f = val;
+}
+
+void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
+{
+    ImGuiStorageFindOrAdd(this, key, val)->val_p = val;
+}
+
+bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
+{
+    return GetInt(key, default_val ? 1 : 0) != 0;
+}
+
+bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
+{
+    return (bool*)GetIntRef(key, default_val ? 1 : 0);
+}
+
+void ImGuiStorage::SetBool(ImGuiID key, bool val)
+{
+    SetInt(key, val ? 1 : 0);
+}
+
+void ImGuiStorage::SetAllInt(int v)
+{
+    for (int i = 0; i < Data.Size; i++)
+        Data[i].val_i = v;
+}
+
+#else // #ifdef IMGUI_STORAGE_OPEN_ADDRESSING
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -2706,6 +2884,8 @@ void ImGuiStorage::SetAllInt(int v)
     for (int i = 0; i < Data.Size; i++)
         Data[i].val_i = v;
 }
+
+#endif // #ifdef IMGUI_STORAGE_OPEN_ADDRESSING
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 //-----------------------------------------------------------------------------
@@ -4431,6 +4611,10 @@ void* ImGui::MemAlloc(size_t size)
 {
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
+#ifdef IMGUI_CONTEXT_FREE_THREAD
+    // Unreal ImGui: Threads that don't own the current context don't record allocations in it (see imconfig.h).
+    if (!IMGUI_CONTEXT_FREE_THREAD())
+#endif
     if (ImGuiContext* ctx = GImGui)
         DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
 #endif
@@ -4441,6 +4625,10 @@ void* ImGui::MemAlloc(size_t size)
 void ImGui::MemFree(void* ptr)
 {
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
+#ifdef IMGUI_CONTEXT_FREE_THREAD
+    // Unreal ImGui: See ImGui::MemAlloc().
+    if (!IMGUI_CONTEXT_FREE_THREAD())
+#endif
     if (ptr != NULL)
         if (ImGuiContext* ctx = GImGui)
             DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
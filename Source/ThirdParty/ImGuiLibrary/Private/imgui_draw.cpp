@@ -723,6 +723,130 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+//---- Unreal ImGui: Vectorized normals for AddPolyline() and AddConvexPolyFilled(). Two points are processed per
+// iteration with SSE or AArch64 NEON, with scalar code for the remaining points and when SIMD is disabled
+// (IMGUI_DISABLE_SSE). SSE results match the scalar code exactly (same reciprocal square root approximation and
+// division). NEON refines its reciprocal square root estimate and matches the scalar code within float precision.
+
+// Compute normals of line segments [first, count) with scalar code. Used for the remaining segments of the vectorized
+// version and to test it.
+void ImDrawListComputeSegmentNormalsScalar(const ImVec2* points, const int points_count, const int first, const int count, ImVec2* out_normals)
+{
+    for (int i1 = first; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+}
+
+// Compute averaged normals at points [first, last) with scalar code. Used for the remaining points of the vectorized
+// version and to test it.
+void ImDrawListComputeMiterNormalsScalar(const ImVec2* normals, const int points_count, const int first, const int last, ImVec2* out_miters)
+{
+    for (int i1 = first; i1 < last; i1++)
+    {
+        const int i0 = i1 == 0 ? points_count - 1 : i1 - 1;
+        float dm_x = (normals[i0].x + normals[i1].x) * 0.5f;
+        float dm_y = (normals[i0].y + normals[i1].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_miters[i1].x = dm_x;
+        out_miters[i1].y = dm_y;
+    }
+}
+
+// Compute normals of <count> line segments, where segment i goes from points[i] to points[(i + 1) % points_count].
+void ImDrawListComputeSegmentNormals(const ImVec2* points, const int points_count, const int count, ImVec2* out_normals)
+{
+    int i1 = 0;
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 negate_y = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+    for (; i1 + 1 < count && i1 + 2 < points_count; i1 += 2)
+    {
+        const __m128 p1 = _mm_loadu_ps(&points[i1].x);     // p[i1], p[i1+1]
+        const __m128 p2 = _mm_loadu_ps(&points[i1 + 1].x); // p[i1+1], p[i1+2]
+        const __m128 d = _mm_sub_ps(p2, p1);
+        const __m128 sq = _mm_mul_ps(d, d);
+        const __m128 d2 = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+        const __m128 mask = _mm_cmpgt_ps(d2, zero);
+        const __m128 inv_len = _mm_or_ps(_mm_and_ps(mask, _mm_rsqrt_ps(d2)), _mm_andnot_ps(mask, one));
+        const __m128 n = _mm_mul_ps(d, inv_len);
+        _mm_storeu_ps(&out_normals[i1].x, _mm_xor_ps(_mm_shuffle_ps(n, n, _MM_SHUFFLE(2, 3, 0, 1)), negate_y)); // (dy, -dx)
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    static const float negate_y_values[4] = { 1.0f, -1.0f, 1.0f, -1.0f };
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t negate_y = vld1q_f32(negate_y_values);
+    for (; i1 + 1 < count && i1 + 2 < points_count; i1 += 2)
+    {
+        const float32x4_t p1 = vld1q_f32(&points[i1].x);
+        const float32x4_t p2 = vld1q_f32(&points[i1 + 1].x);
+        const float32x4_t d = vsubq_f32(p2, p1);
+        const float32x4_t sq = vmulq_f32(d, d);
+        const float32x4_t d2 = vaddq_f32(sq, vrev64q_f32(sq));
+        float32x4_t inv_len = vrsqrteq_f32(d2);
+        inv_len = vmulq_f32(inv_len, vrsqrtsq_f32(vmulq_f32(d2, inv_len), inv_len));
+        inv_len = vmulq_f32(inv_len, vrsqrtsq_f32(vmulq_f32(d2, inv_len), inv_len));
+        inv_len = vbslq_f32(vcgtq_f32(d2, zero), inv_len, one);
+        const float32x4_t n = vmulq_f32(d, inv_len);
+        vst1q_f32(&out_normals[i1].x, vmulq_f32(vrev64q_f32(n), negate_y)); // (dy, -dx)
+    }
+#endif
+    ImDrawListComputeSegmentNormalsScalar(points, points_count, i1, count, out_normals);
+}
+
+// Compute averaged normals at points [first, points_count), blending normals of the segments before and after each
+// point (the segment before the first point is the last one). Result is scaled, so offsetting a point by it gives
+// a miter joint of the line edges.
+void ImDrawListComputeMiterNormals(const ImVec2* normals, const int points_count, const int first, ImVec2* out_miters)
+{
+    int i1 = first;
+    if (i1 == 0 && i1 < points_count)
+    {
+        ImDrawListComputeMiterNormalsScalar(normals, points_count, 0, 1, out_miters);
+        i1++;
+    }
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 min_len2 = _mm_set1_ps(0.000001f);
+    const __m128 max_inv_len2 = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; i1 + 1 < points_count; i1 += 2)
+    {
+        const __m128 n0 = _mm_loadu_ps(&normals[i1 - 1].x); // n[i1-1], n[i1]
+        const __m128 n1 = _mm_loadu_ps(&normals[i1].x);     // n[i1], n[i1+1]
+        const __m128 dm = _mm_mul_ps(_mm_add_ps(n0, n1), half);
+        const __m128 sq = _mm_mul_ps(dm, dm);
+        const __m128 d2 = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+        const __m128 mask = _mm_cmpgt_ps(d2, min_len2);
+        const __m128 inv_len2 = _mm_min_ps(_mm_div_ps(one, d2), max_inv_len2);
+        _mm_storeu_ps(&out_miters[i1].x, _mm_mul_ps(dm, _mm_or_ps(_mm_and_ps(mask, inv_len2), _mm_andnot_ps(mask, one))));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t min_len2 = vdupq_n_f32(0.000001f);
+    const float32x4_t max_inv_len2 = vdupq_n_f32(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; i1 + 1 < points_count; i1 += 2)
+    {
+        const float32x4_t n0 = vld1q_f32(&normals[i1 - 1].x);
+        const float32x4_t n1 = vld1q_f32(&normals[i1].x);
+        const float32x4_t dm = vmulq_f32(vaddq_f32(n0, n1), half);
+        const float32x4_t sq = vmulq_f32(dm, dm);
+        const float32x4_t d2 = vaddq_f32(sq, vrev64q_f32(sq));
+        const float32x4_t inv_len2 = vminq_f32(vdivq_f32(one, d2), max_inv_len2);
+        vst1q_f32(&out_miters[i1].x, vmulq_f32(dm, vbslq_f32(vcgtq_f32(d2, min_len2), inv_len2, one)));
+    }
+#endif
+    ImDrawListComputeMiterNormalsScalar(normals, points_count, i1, points_count, out_miters);
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -759,24 +883,21 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        // The first <points_count> items are normals of line segments, then after that there are averaged normals at each line point
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
+        ImVec2* temp_miters = temp_normals + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        ImDrawListComputeSegmentNormals(points, points_count, count, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
 
+        // Average normals at each line point. If line is not closed, the first point has no normals to blend.
+        ImDrawListComputeMiterNormals(temp_normals, points_count, closed ? 0 : 1, temp_miters);
+        if (!closed)
+            temp_miters[0] = temp_normals[0];
+
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
         {
@@ -790,38 +911,13 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the first point in a closed line being used as the final one (as n+1 wraps)
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -842,7 +938,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 idx1 = idx2;
             }
 
-            // Add vertexes for each point on the line
+            // Add vertexes for each point on the line, offset to the outer edges of the AA area
             if (use_texture)
             {
                 // If we're using textures we only need to emit the left/right edge vertices
@@ -859,8 +955,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                    const float dm_x = temp_miters[i].x * half_draw_size;
+                    const float dm_y = temp_miters[i].y * half_draw_size;
+                    _VtxWritePtr[0].pos.x = points[i].x + dm_x; _VtxWritePtr[0].pos.y = points[i].y + dm_y; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
+                    _VtxWritePtr[1].pos.x = points[i].x - dm_x; _VtxWritePtr[1].pos.y = points[i].y - dm_y; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
                     _VtxWritePtr += 2;
                 }
             }
@@ -869,9 +967,11 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 // If we're not using a texture, we need the center vertex as well
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    const float dm_x = temp_miters[i].x * half_draw_size;
+                    const float dm_y = temp_miters[i].y * half_draw_size;
+                    _VtxWritePtr[0].pos = points[i];                                                        _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
+                    _VtxWritePtr[1].pos.x = points[i].x + dm_x; _VtxWritePtr[1].pos.y = points[i].y + dm_y; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
+                    _VtxWritePtr[2].pos.x = points[i].x - dm_x; _VtxWritePtr[2].pos.y = points[i].y - dm_y; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
                     _VtxWritePtr += 3;
                 }
             }
@@ -881,49 +981,13 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the first point in a closed line being used as the final one (as n+1 wraps)
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
@@ -939,10 +1003,14 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // Add vertices
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                const float dm_out_x = temp_miters[i].x * (half_inner_thickness + AA_SIZE);
+                const float dm_out_y = temp_miters[i].y * (half_inner_thickness + AA_SIZE);
+                const float dm_in_x = temp_miters[i].x * half_inner_thickness;
+                const float dm_in_y = temp_miters[i].y * half_inner_thickness;
+                _VtxWritePtr[0].pos.x = points[i].x + dm_out_x; _VtxWritePtr[0].pos.y = points[i].y + dm_out_y; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
+                _VtxWritePtr[1].pos.x = points[i].x + dm_in_x;  _VtxWritePtr[1].pos.y = points[i].y + dm_in_y;  _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos.x = points[i].x - dm_in_x;  _VtxWritePtr[2].pos.y = points[i].y - dm_in_y;  _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos.x = points[i].x - dm_out_x; _VtxWritePtr[3].pos.y = points[i].y - dm_out_y; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
                 _VtxWritePtr += 4;
             }
         }
@@ -1009,29 +1077,18 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         }
 
         // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        ImVec2* temp_miters = temp_normals + points_count;
+        ImDrawListComputeSegmentNormals(points, points_count, points_count, temp_normals);
+
+        // Average normals
+        ImDrawListComputeMiterNormals(temp_normals, points_count, 0, temp_miters);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
+            const float dm_x = temp_miters[i1].x * (AA_SIZE * 0.5f);
+            const float dm_y = temp_miters[i1].y * (AA_SIZE * 0.5f);
 
             // Add vertices
             _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
@@ -1971,29 +2028,18 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         }
 
         // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        ImVec2* temp_miters = temp_normals + points_count;
+        ImDrawListComputeSegmentNormals(points, points_count, points_count, temp_normals);
+
+        // Average normals
+        ImDrawListComputeMiterNormals(temp_normals, points_count, 0, temp_miters);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
+            const float dm_x = temp_miters[i1].x * (AA_SIZE * 0.5f);
+            const float dm_y = temp_miters[i1].y * (AA_SIZE * 0.5f);
 
             // Add vertices
             _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
@@ -2512,7 +2558,7 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
     ImFontConfig& new_font_cfg = ConfigData.back();
     if (new_font_cfg.DstFont == NULL)
         new_font_cfg.DstFont = Fonts.back();
-    if (!new_font_cfg.FontDataOwnedByAtlas)
+    if (!new_font_cfg.FontDataOwnedByAtlas && !new_font_cfg.FontDataReferenced) // Unreal ImGui: Referenced data is not copied
     {
         new_font_cfg.FontData = IM_ALLOC(new_font_cfg.FontDataSize);
         new_font_cfg.FontDataOwnedByAtlas = true;
@@ -2963,6 +3009,46 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+#ifdef IMGUI_PARALLEL_FOR
+    // Unreal ImGui: Rasterize glyphs in chunks that are processed in parallel. Chunks write to separate rectangles of the
+    // texture and each of them uses its own copy of the pack context, because stb_truetype modifies it while rendering.
+    struct ImFontBuildRasterChunk { int SrcIndex; int GlyphBegin; int GlyphCount; };
+    struct ImFontBuildRasterJob { ImFontAtlas* Atlas; ImFontBuildSrcData* SrcData; const stbtt_pack_context* PackContext; ImVector<ImFontBuildRasterChunk> Chunks; };
+    const int RASTER_CHUNK_GLYPHS = 128;
+    ImFontBuildRasterJob raster_job = { atlas, src_tmp_array.Data, &spc, {} };
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i += RASTER_CHUNK_GLYPHS)
+            raster_job.Chunks.push_back({ src_i, glyph_i, ImMin(RASTER_CHUNK_GLYPHS, src_tmp_array[src_i].GlyphsCount - glyph_i) });
+
+    IMGUI_PARALLEL_FOR(raster_job.Chunks.Size, [](int chunk_i, void* user_data)
+    {
+        const ImFontBuildRasterJob& job = *(const ImFontBuildRasterJob*)user_data;
+        const ImFontBuildRasterChunk& chunk = job.Chunks[chunk_i];
+        const ImFontConfig& cfg = job.Atlas->ConfigData[chunk.SrcIndex];
+        ImFontBuildSrcData& src_tmp = job.SrcData[chunk.SrcIndex];
+
+        stbtt_pack_context chunk_spc = *job.PackContext;
+        stbtt_pack_range chunk_range = src_tmp.PackRange;
+        chunk_range.array_of_unicode_codepoints += chunk.GlyphBegin;
+        chunk_range.chardata_for_range += chunk.GlyphBegin;
+        chunk_range.num_chars = chunk.GlyphCount;
+        stbtt_PackFontRangesRenderIntoRects(&chunk_spc, &src_tmp.FontInfo, &chunk_range, 1, src_tmp.Rects + chunk.GlyphBegin);
+
+        // Apply multiply operator
+        if (cfg.RasterizerMultiply != 1.0f)
+        {
+            unsigned char multiply_table[256];
+            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+            stbrp_rect* r = &src_tmp.Rects[chunk.GlyphBegin];
+            for (int glyph_i = 0; glyph_i < chunk.GlyphCount; glyph_i++, r++)
+                if (r->was_packed)
+                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, job.Atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, job.Atlas->TexWidth * 1);
+        }
+    }, &raster_job);
+
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
+#else
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontConfig& cfg = atlas->ConfigData[src_i];
@@ -2984,6 +3070,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         }
         src_tmp.Rects = NULL;
     }
+#endif
 
     // End packing
     stbtt_PackEnd(&spc);
@@ -3932,6 +4019,20 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // FIXME-OPT: Need to avoid this.
 
+#ifdef IMGUI_TEXT_CACHE
+    unsigned long long text_hash = 0;
+    {
+        ImVec2 cached_size;
+        const char* cached_remaining = NULL;
+        if (ImGuiTextCache::FindTextSize(this, size, max_width, wrap_width, text_begin, text_end, &text_hash, &cached_size, &cached_remaining))
+        {
+            if (remaining)
+                *remaining = cached_remaining;
+            return cached_size;
+        }
+    }
+#endif
+
     const float line_height = size;
     const float scale = size / FontSize;
 
@@ -3962,6 +4063,23 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
             }
         }
 
+        // Unreal ImGui: Measure runs of printable ASCII characters without decoding or checking for control characters
+        const char* ascii_end = s + ImTextCountAsciiRun(s, word_wrap_enabled ? word_wrap_eol : text_end, ' ');
+        if (ascii_end > s)
+        {
+            for (; s < ascii_end; s++)
+            {
+                const int c = (unsigned char)*s;
+                const float char_width = (c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+                if (line_width + char_width >= max_width)
+                    break;
+                line_width += char_width;
+            }
+            if (s < ascii_end)
+                break;
+            continue;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -4002,6 +4120,10 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     if (remaining)
         *remaining = s;
 
+#ifdef IMGUI_TEXT_CACHE
+    ImGuiTextCache::AddTextSize(text_hash, this, size, max_width, wrap_width, text_begin, text_end, text_size, s);
+#endif
+
     return text_size;
 }
 
@@ -4009,6 +4131,10 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c) const
 {
     const ImFontGlyph* glyph = FindGlyph(c);
+#ifdef IMGUI_ON_MISSING_GLYPH
+    if (glyph == FallbackGlyph && c != FallbackChar)
+        IMGUI_ON_MISSING_GLYPH(this, c);
+#endif
     if (!glyph || !glyph->Visible)
         return;
     if (glyph->Colored)
@@ -4086,6 +4212,9 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
+#ifdef IMGUI_TEXT_CACHE
+    void* word_wrap_cache = word_wrap_enabled ? ImGuiTextCache::FindWordWrap(this, scale, wrap_width, text_begin, text_end) : NULL;
+#endif
 
     while (s < text_end)
     {
@@ -4093,7 +4222,12 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         {
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
             if (!word_wrap_eol)
+#ifdef IMGUI_TEXT_CACHE
+                word_wrap_eol = word_wrap_cache ? ImGuiTextCache::CalcWordWrapPosition(word_wrap_cache, this, scale, wrap_width - (x - start_x), text_begin, s, text_end)
+                                                : CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - start_x));
+#else
                 word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - start_x));
+#endif
 
             if (s >= word_wrap_eol)
             {
@@ -4129,6 +4263,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         }
 
         const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
+#ifdef IMGUI_ON_MISSING_GLYPH
+        if (glyph == FallbackGlyph && c != FallbackChar)
+            IMGUI_ON_MISSING_GLYPH(this, c);
+#endif
         if (glyph == NULL)
             continue;
 
@@ -62,6 +62,16 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+//---- Unreal ImGui: SSE2 and AArch64 NEON intrinsics, used to vectorize text scanning and tessellation. Both are disabled
+// together with SSE (IMGUI_DISABLE_SSE).
+#if defined(IMGUI_ENABLE_SSE) && (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
+#if !defined(IMGUI_ENABLE_SSE) && (defined(__aarch64__) || defined(_M_ARM64)) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -397,6 +407,25 @@ IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, cons
 IMGUI_API const char*   ImTextFindPreviousUtf8Codepoint(const char* in_text_start, const char* in_text_curr);                   // return previous UTF-8 code-point.
 IMGUI_API int           ImTextCountLines(const char* in_text, const char* in_text_end);                                         // return number of lines taken by text. trailing carriage return doesn't count as an extra line.
 
+//---- Unreal ImGui: Return length of the run of ASCII characters in [min_char, 0x7F] at the beginning of the text. Scans
+// 16 bytes at a time with SSE2 or NEON, so callers can skip UTF-8 decoding for ASCII text. Requires text end.
+static inline int ImTextCountAsciiRun(const char* in_text, const char* in_text_end, char min_char)
+{
+    const char* s = in_text;
+#if defined(IMGUI_ENABLE_SSE2)
+    // Signed comparison flags both bytes below min_char and bytes >= 0x80.
+    const __m128i min_v = _mm_set1_epi8(min_char);
+    while (in_text_end - s >= 16 && _mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128((const __m128i*)(const void*)s), min_v)) == 0)
+        s += 16;
+#elif defined(IMGUI_ENABLE_NEON)
+    while (in_text_end - s >= 16 && vminvq_s8(vld1q_s8((const int8_t*)s)) >= min_char)
+        s += 16;
+#endif
+    while (s < in_text_end && (signed char)*s >= min_char)
+        s++;
+    return (int)(s - in_text);
+}
+
 // Helpers: File System
 #ifdef IMGUI_DISABLE_FILE_FUNCTIONS
 #define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
@@ -756,6 +785,13 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+//---- Unreal ImGui: Normals used by AddPolyline() and AddConvexPolyFilled(), vectorized with SSE or NEON, and their
+// scalar versions, which compute the same results (see imgui_draw.cpp).
+IMGUI_API void ImDrawListComputeSegmentNormals(const ImVec2* points, const int points_count, const int count, ImVec2* out_normals);
+IMGUI_API void ImDrawListComputeMiterNormals(const ImVec2* normals, const int points_count, const int first, ImVec2* out_miters);
+IMGUI_API void ImDrawListComputeSegmentNormalsScalar(const ImVec2* points, const int points_count, const int first, const int count, ImVec2* out_normals);
+IMGUI_API void ImDrawListComputeMiterNormalsScalar(const ImVec2* normals, const int points_count, const int first, const int last, ImVec2* out_miters);
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
@@ -2334,6 +2370,9 @@ struct ImGuiContext
     int                     WantTextInputNextFrame;
     ImVector<char>          TempBuffer;                         // Temporary text buffer
     char                    TempKeychordName[64];
+#ifdef IMGUI_TEXT_CACHE
+    void*                   TextCache;                          // Unreal ImGui: Per-context cache used by IMGUI_TEXT_CACHE hooks (see imconfig.h). Owned by the user.
+#endif
 
     ImGuiContext(ImFontAtlas* shared_font_atlas)
     {
@@ -2538,6 +2577,9 @@ struct ImGuiContext
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
         memset(TempKeychordName, 0, sizeof(TempKeychordName));
+#ifdef IMGUI_TEXT_CACHE
+        TextCache = NULL;
+#endif
     }
 };
 
@@ -3856,6 +3856,18 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
     const char* s = text_begin;
     while (s < text_end)
     {
+        // Unreal ImGui: Measure runs of printable ASCII characters without decoding
+        const char* ascii_end = s + ImTextCountAsciiRun(s, text_end, ' ');
+        if (ascii_end > s)
+        {
+            for (; s < ascii_end; s++)
+            {
+                const int c = (unsigned char)*s;
+                line_width += (c < font->IndexAdvanceX.Size ? font->IndexAdvanceX.Data[c] : font->FallbackAdvanceX) * scale;
+            }
+            continue;
+        }
+
         unsigned int c = (unsigned int)*s;
         if (c < 0x80)
             s += 1;
@@ -7983,6 +7995,10 @@ void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
     ImSwap(Size, r.Size);
     ImSwap(_SelectionOrder, r._SelectionOrder);
     _Storage.Data.swap(r._Storage.Data);
+#ifdef IMGUI_STORAGE_OPEN_ADDRESSING
+    _Storage._Index.swap(r._Storage._Index);
+    ImSwap(_Storage._IndexedSize, r._Storage._IndexedSize);
+#endif
 }
 
 bool ImGuiSelectionBasicStorage::Contains(ImGuiID id) const
@@ -8030,6 +8046,14 @@ void ImGuiSelectionBasicStorage::SetItemSelected(ImGuiID id, bool selected)
 static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicStorage* selection, ImGuiID id, bool selected, int size_before_amends, int selection_order)
 {
     ImGuiStorage* storage = &selection->_Storage;
+#ifdef IMGUI_STORAGE_OPEN_ADDRESSING
+    // Unreal ImGui: Pairs are not sorted, but lookup and insertion are cheap, so modify storage directly.
+    IM_UNUSED(size_before_amends);
+    if (selected == (storage->GetInt(id, 0) != 0))
+        return;
+    storage->SetInt(id, selected ? selection_order : 0);
+    selection->Size += selected ? +1 : -1;
+#else
     ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + size_before_amends, id);
     const bool is_contained = (it != storage->Data.Data + size_before_amends) && (it->key == id);
     if (selected == (is_contained && it->val_i != 0))
@@ -8039,6 +8063,7 @@ static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicS
     else if (is_contained)
         it->val_i = selected ? selection_order : 0; // Modify in-place.
     selection->Size += selected ? +1 : -1;
+#endif
 }
 
 static void ImGuiSelectionBasicStorage_BatchFinish(ImGuiSelectionBasicStorage* selection, bool selected, int size_before_amends)